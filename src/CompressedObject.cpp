@@ -0,0 +1,79 @@
+/**
+ * CompressedObject.cpp
+ *
+ * Copyright 2019 mikee47 <mike@sillyhouse.net>
+ *
+ * This file is part of the FlashString Library
+ *
+ * This library is free software: you can redistribute it and/or modify it under the terms of the
+ * GNU General Public License as published by the Free Software Foundation, version 3 or later.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with FlashString.
+ * If not, see <https://www.gnu.org/licenses/>.
+ *
+ ****/
+
+#include "include/FlashString/CompressedObject.hpp"
+#include "include/FlashString/Inflate.hpp"
+#include <memory>
+
+namespace FSTR
+{
+bool CompressedObject::getHeader(Header& header) const
+{
+	auto len = length();
+	if(len < sizeof(Header)) {
+		return false;
+	}
+
+	ObjectBase::read(0, &header, sizeof(header));
+	if(header.magic != magic || header.encoding != Encoding::gzip || header.windowBits < 9 ||
+	   header.windowBits > 15) {
+		return false;
+	}
+
+	return len >= deflateOffset(header) + gzipTrailerSize;
+}
+
+size_t CompressedObject::getBlockOffset(const Header& header, size_t& position) const
+{
+	if(header.blockSize == 0) {
+		position = 0;
+		return deflateOffset(header);
+	}
+
+	auto block = position / header.blockSize;
+	position = block * header.blockSize;
+	uint32_t offset;
+	ObjectBase::read(sizeof(Header) + block * sizeof(uint32_t), &offset, sizeof(offset));
+	return deflateOffset(header) + offset;
+}
+
+size_t CompressedObject::read(size_t offset, void* buffer, size_t count) const
+{
+	Header header;
+	if(!getHeader(header) || offset >= header.originalLength) {
+		return 0;
+	}
+
+	count = std::min(count, header.originalLength - offset);
+	auto windowSize = 1U << header.windowBits;
+	std::unique_ptr<uint8_t[]> window(new uint8_t[windowSize]);
+	std::unique_ptr<Inflate> inflate(new Inflate(*this, window.get(), windowSize));
+	if(!window || !inflate) {
+		return 0;
+	}
+
+	size_t position = offset;
+	inflate->begin(getBlockOffset(header, position));
+	if(inflate->read(nullptr, offset - position) != offset - position) {
+		return 0;
+	}
+	return inflate->read(static_cast<uint8_t*>(buffer), count);
+}
+
+} // namespace FSTR
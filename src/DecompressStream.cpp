@@ -0,0 +1,101 @@
+/**
+ * DecompressStream.cpp
+ *
+ * Copyright 2019 mikee47 <mike@sillyhouse.net>
+ *
+ * This file is part of the FlashString Library
+ *
+ * This library is free software: you can redistribute it and/or modify it under the terms of the
+ * GNU General Public License as published by the Free Software Foundation, version 3 or later.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with FlashString.
+ * If not, see <https://www.gnu.org/licenses/>.
+ *
+ ****/
+
+#include "include/FlashString/DecompressStream.hpp"
+
+namespace FSTR
+{
+DecompressStream::DecompressStream(const CompressedObject& object)
+	: object(object), windowSize(object.getHeader(header) ? (1U << header.windowBits) : 0),
+	  window(windowSize ? new uint8_t[windowSize] : nullptr), inflate(object, window.get(), windowSize)
+{
+	if(window) {
+		inflate.begin(CompressedObject::deflateOffset(header));
+	} else {
+		header.originalLength = 0;
+	}
+}
+
+uint16_t DecompressStream::readMemoryBlock(char* data, int bufSize)
+{
+	if(!window || bufSize <= 0) {
+		return 0;
+	}
+
+	// Data which hasn't been consumed must remain in the window
+	size_t count = std::min(size_t(bufSize), windowSize);
+	size_t buffered = base + inflate.getOutputPosition() - readPos;
+	if(count > buffered) {
+		inflate.read(nullptr, count - buffered);
+		buffered = base + inflate.getOutputPosition() - readPos;
+	}
+	count = std::min(count, buffered);
+
+	// Window is circular
+	auto start = (readPos - base) & (windowSize - 1);
+	auto n = std::min(count, windowSize - start);
+	memcpy(data, &window[start], n);
+	memcpy(data + n, &window[0], count - n);
+	return count;
+}
+
+int DecompressStream::seekFrom(int offset, unsigned origin)
+{
+	size_t newPos;
+	switch(origin) {
+	case SEEK_SET:
+		newPos = offset;
+		break;
+	case SEEK_CUR:
+		newPos = readPos + offset;
+		break;
+	case SEEK_END:
+		newPos = header.originalLength + offset;
+		break;
+	default:
+		return -1;
+	}
+
+	if(!window || newPos > header.originalLength) {
+		return -1;
+	}
+
+	auto outPos = base + inflate.getOutputPosition();
+	if(newPos < base || newPos > outPos || outPos - newPos > windowSize) {
+		// Data is not in the window: restart at containing block unless it's quicker to carry on
+		size_t blockStart = newPos;
+		auto blockOffset = object.getBlockOffset(header, blockStart);
+		if(newPos < outPos || blockStart > outPos) {
+			inflate.begin(blockOffset);
+			base = outPos = blockStart;
+		}
+	}
+
+	if(newPos > outPos) {
+		inflate.read(nullptr, newPos - outPos);
+		if(base + inflate.getOutputPosition() != newPos) {
+			return -1;
+		}
+	}
+
+	readPos = newPos;
+	return readPos;
+}
+
+} // namespace FSTR
@@ -0,0 +1,44 @@
+/**
+ * Hash.cpp
+ *
+ * Copyright 2019 mikee47 <mike@sillyhouse.net>
+ *
+ * This file is part of the FlashString Library
+ *
+ * This library is free software: you can redistribute it and/or modify it under the terms of the
+ * GNU General Public License as published by the Free Software Foundation, version 3 or later.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with FlashString.
+ * If not, see <https://www.gnu.org/licenses/>.
+ *
+ ****/
+
+#include "include/FlashString/Hash.hpp"
+
+namespace FSTR
+{
+namespace Hash
+{
+uint32_t calculate(const void* data, size_t length, bool ignoreCase, uint32_t seed)
+{
+	auto ptr = static_cast<const uint8_t*>(data);
+	uint32_t h = fnvOffset ^ seed;
+	if(ignoreCase) {
+		while(length-- != 0) {
+			h = (h ^ foldCase(*ptr++)) * fnvPrime;
+		}
+	} else {
+		while(length-- != 0) {
+			h = (h ^ *ptr++) * fnvPrime;
+		}
+	}
+	return mix(h);
+}
+
+} // namespace Hash
+
+} // namespace FSTR
@@ -0,0 +1,128 @@
+/**
+ * IndexedTemplateStream.cpp
+ *
+ * Copyright 2019 mikee47 <mike@sillyhouse.net>
+ *
+ * This file is part of the FlashString Library
+ *
+ * This library is free software: you can redistribute it and/or modify it under the terms of the
+ * GNU General Public License as published by the Free Software Foundation, version 3 or later.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with FlashString.
+ * If not, see <https://www.gnu.org/licenses/>.
+ *
+ ****/
+
+#include "include/FlashString/IndexedTemplateStream.hpp"
+
+namespace FSTR
+{
+WString IndexedTemplateStream::getValue(const char* name)
+{
+	return (vars.indexOf(name) < 0) ? nullptr : vars[name];
+}
+
+void IndexedTemplateStream::prepare()
+{
+	if(prepared) {
+		return;
+	}
+	prepared = true;
+
+	while(!inValue && tagIndex < index.count()) {
+		auto tag = index.getTag(tagIndex);
+		if(tag.offset > readPos) {
+			break;
+		}
+		if(tag.offset < readPos || tag.offset + tag.length > content.length() ||
+		   tag.nameOffset + tag.nameLength > tag.length) {
+			// Index doesn't match content
+			++tagIndex;
+			continue;
+		}
+
+		char name[tag.nameLength + 1];
+		content.read(tag.offset + tag.nameOffset, name, tag.nameLength);
+		name[tag.nameLength] = '\0';
+		value = getValue(name);
+		if(!value) {
+			// Output placeholder as literal text
+			++tagIndex;
+			break;
+		}
+		if(value.length() == 0) {
+			readPos += tag.length;
+			++tagIndex;
+			continue;
+		}
+		valuePos = 0;
+		inValue = true;
+	}
+}
+
+uint16_t IndexedTemplateStream::readMemoryBlock(char* data, int bufSize)
+{
+	if(bufSize <= 0) {
+		return 0;
+	}
+
+	prepare();
+
+	if(inValue) {
+		auto count = std::min(size_t(bufSize), value.length() - valuePos);
+		memcpy(data, value.c_str() + valuePos, count);
+		return count;
+	}
+
+	// Copy literal text up to the next placeholder
+	auto count = std::min(size_t(bufSize), nextTagOffset() - readPos);
+	return content.readFlash(readPos, data, count);
+}
+
+int IndexedTemplateStream::seekFrom(int offset, unsigned origin)
+{
+	if(origin != SEEK_CUR || offset < 0) {
+		return -1;
+	}
+
+	size_t remaining = offset;
+	while(remaining != 0) {
+		prepare();
+		size_t count;
+		if(inValue) {
+			count = std::min(remaining, value.length() - valuePos);
+			valuePos += count;
+			if(valuePos == value.length()) {
+				readPos += index.getTag(tagIndex).length;
+				++tagIndex;
+				inValue = false;
+				value = nullptr;
+				prepared = false;
+			}
+		} else {
+			count = std::min(remaining, nextTagOffset() - readPos);
+			if(count == 0) {
+				// End of content
+				return -1;
+			}
+			readPos += count;
+			prepared = false;
+		}
+		remaining -= count;
+		outputPos += count;
+	}
+
+	return outputPos;
+}
+
+bool IndexedTemplateStream::isFinished()
+{
+	prepare();
+	return !inValue && readPos >= content.length();
+}
+
+} // namespace FSTR
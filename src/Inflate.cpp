@@ -0,0 +1,350 @@
+/**
+ * Inflate.cpp
+ *
+ * Copyright 2019 mikee47 <mike@sillyhouse.net>
+ *
+ * This file is part of the FlashString Library
+ *
+ * This library is free software: you can redistribute it and/or modify it under the terms of the
+ * GNU General Public License as published by the Free Software Foundation, version 3 or later.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with FlashString.
+ * If not, see <https://www.gnu.org/licenses/>.
+ *
+ ****/
+
+#include "include/FlashString/Inflate.hpp"
+
+namespace FSTR
+{
+namespace
+{
+// Base values and extra bits for length codes 257 - 285
+const uint16_t lengthBase[] PROGMEM = {3,  4,  5,  6,  7,  8,  9,  10, 11,  13,  15,  17,  19,  23, 27,
+									   31, 35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258};
+const uint8_t lengthExtra[] PROGMEM = {0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2,
+									   2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0};
+
+// Base values and extra bits for distance codes 0 - 29
+const uint16_t distBase[] PROGMEM = {1,	2,	 3,	  4,   5,	7,	  9,	13,	  17,	25,	  33,	49,	  65,	97,	  129,
+									 193, 257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577};
+const uint8_t distExtra[] PROGMEM = {0, 0, 0, 0, 1, 1, 2, 2,  3,  3,  4,  4,  5,  5,  6,
+									 6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13};
+
+// Order in which code length code lengths are stored
+const uint8_t codeLengthOrder[] PROGMEM = {16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15};
+
+constexpr unsigned lengthCodeCount = sizeof(lengthBase) / sizeof(lengthBase[0]);
+constexpr unsigned distCodeCount = sizeof(distBase) / sizeof(distBase[0]);
+constexpr unsigned codeLengthCodeCount = sizeof(codeLengthOrder) / sizeof(codeLengthOrder[0]);
+
+} // namespace
+
+void Inflate::begin(size_t offset)
+{
+	inPos = offset;
+	inputPos = inputLength = 0;
+	bitBuffer = 0;
+	bitCount = 0;
+	lastBlock = false;
+	storedRemaining = 0;
+	matchLength = 0;
+	outPos = 0;
+	state = State::blockHeader;
+}
+
+uint8_t Inflate::nextByte()
+{
+	if(inputPos >= inputLength) {
+		inputLength = object.readFlash(inPos, input, sizeof(input));
+		inputPos = 0;
+		if(inputLength == 0) {
+			// Ran out of data
+			state = State::error;
+			return 0;
+		}
+		inPos += inputLength;
+	}
+	return input[inputPos++];
+}
+
+uint32_t Inflate::getBits(unsigned count)
+{
+	while(bitCount < count) {
+		bitBuffer |= uint32_t(nextByte()) << bitCount;
+		bitCount += 8;
+	}
+	uint32_t value = bitBuffer & ((1U << count) - 1);
+	bitBuffer >>= count;
+	bitCount -= count;
+	return value;
+}
+
+template <size_t symbolCount> bool Inflate::buildTree(Tree<symbolCount>& tree, const uint8_t* lengths, unsigned count)
+{
+	memset(tree.counts, 0, sizeof(tree.counts));
+	for(unsigned i = 0; i < count; ++i) {
+		++tree.counts[lengths[i]];
+	}
+	tree.counts[0] = 0;
+
+	// Check for over-subscribed code
+	int left = 1;
+	for(unsigned len = 1; len < 16; ++len) {
+		left = (left << 1) - tree.counts[len];
+		if(left < 0) {
+			return false;
+		}
+	}
+
+	uint16_t offsets[16];
+	unsigned sum = 0;
+	for(unsigned len = 0; len < 16; ++len) {
+		offsets[len] = sum;
+		sum += tree.counts[len];
+	}
+
+	for(unsigned i = 0; i < count; ++i) {
+		if(lengths[i] != 0) {
+			tree.symbols[offsets[lengths[i]]++] = i;
+		}
+	}
+
+	return true;
+}
+
+template <size_t symbolCount> int Inflate::decodeSymbol(const Tree<symbolCount>& tree)
+{
+	// Codes are stored most-significant bit first, read one bit at a time until code falls within range
+	int code = 0;
+	int first = 0;
+	int index = 0;
+	for(unsigned len = 1; len < 16; ++len) {
+		code |= getBits(1);
+		int count = tree.counts[len];
+		if(code - first < count) {
+			return tree.symbols[index + code - first];
+		}
+		index += count;
+		first = (first + count) << 1;
+		code <<= 1;
+	}
+
+	state = State::error;
+	return -1;
+}
+
+bool Inflate::buildFixedTrees()
+{
+	uint8_t lengths[maxLitCodes];
+	memset(&lengths[0], 8, 144);
+	memset(&lengths[144], 9, 256 - 144);
+	memset(&lengths[256], 7, 280 - 256);
+	memset(&lengths[280], 8, maxLitCodes - 280);
+	buildTree(litTree, lengths, maxLitCodes);
+
+	memset(lengths, 5, distCodeCount);
+	buildTree(distTree, lengths, distCodeCount);
+	return true;
+}
+
+bool Inflate::buildDynamicTrees()
+{
+	unsigned litCount = getBits(5) + 257;
+	unsigned distCount = getBits(5) + 1;
+	unsigned codeLengthCount = getBits(4) + 4;
+	if(litCount > 286 || distCount > 30) {
+		return false;
+	}
+
+	uint8_t lengths[maxLitCodes + maxDistCodes]{};
+	for(unsigned i = 0; i < codeLengthCount; ++i) {
+		lengths[pgm_read_byte(&codeLengthOrder[i])] = getBits(3);
+	}
+
+	// Code length tree is only needed temporarily, so use the distance tree storage
+	if(!buildTree(distTree, lengths, codeLengthCodeCount)) {
+		return false;
+	}
+	memset(lengths, 0, codeLengthCodeCount);
+
+	unsigned total = litCount + distCount;
+	for(unsigned i = 0; i < total;) {
+		int symbol = decodeSymbol(distTree);
+		if(symbol < 0) {
+			return false;
+		}
+		if(symbol < 16) {
+			lengths[i++] = symbol;
+			continue;
+		}
+
+		uint8_t value = 0;
+		unsigned repeat;
+		if(symbol == 16) {
+			if(i == 0) {
+				return false;
+			}
+			value = lengths[i - 1];
+			repeat = 3 + getBits(2);
+		} else if(symbol == 17) {
+			repeat = 3 + getBits(3);
+		} else {
+			repeat = 11 + getBits(7);
+		}
+		if(i + repeat > total) {
+			return false;
+		}
+		while(repeat-- != 0) {
+			lengths[i++] = value;
+		}
+	}
+
+	// End-of-block code is required
+	if(lengths[256] == 0) {
+		return false;
+	}
+
+	return buildTree(litTree, lengths, litCount) && buildTree(distTree, &lengths[litCount], distCount);
+}
+
+bool Inflate::startBlock()
+{
+	if(lastBlock) {
+		state = State::done;
+		return true;
+	}
+
+	lastBlock = getBits(1);
+	unsigned blockType = getBits(2);
+	// Input may run out whilst reading the header
+	if(state == State::error) {
+		return false;
+	}
+
+	switch(blockType) {
+	case 0: {
+		// Stored block starts on a byte boundary
+		getBits(bitCount & 0x07);
+		uint16_t len = getBits(16);
+		uint16_t nlen = getBits(16);
+		if(state == State::error || len != uint16_t(~nlen)) {
+			return false;
+		}
+		storedRemaining = len;
+		state = State::stored;
+		return true;
+	}
+
+	case 1:
+		if(!buildFixedTrees()) {
+			return false;
+		}
+		break;
+
+	case 2:
+		if(!buildDynamicTrees() || state == State::error) {
+			return false;
+		}
+		break;
+
+	default:
+		return false;
+	}
+
+	state = State::huffman;
+	return true;
+}
+
+bool Inflate::startMatch(unsigned symbol)
+{
+	symbol -= 257;
+	if(symbol >= lengthCodeCount) {
+		return false;
+	}
+	matchLength = pgm_read_word(&lengthBase[symbol]) + getBits(pgm_read_byte(&lengthExtra[symbol]));
+
+	int distSymbol = decodeSymbol(distTree);
+	if(distSymbol < 0 || unsigned(distSymbol) >= distCodeCount) {
+		return false;
+	}
+	matchDistance = pgm_read_word(&distBase[distSymbol]) + getBits(pgm_read_byte(&distExtra[distSymbol]));
+
+	// Cannot refer back further than the window, or to before the start
+	return matchDistance <= outPos && matchDistance <= windowMask + 1;
+}
+
+size_t Inflate::read(uint8_t* buffer, size_t count)
+{
+	size_t n = 0;
+	while(n < count) {
+		if(matchLength != 0) {
+			auto c = window[(outPos - matchDistance) & windowMask];
+			put(c);
+			if(buffer != nullptr) {
+				buffer[n] = c;
+			}
+			++n;
+			--matchLength;
+			continue;
+		}
+
+		switch(state) {
+		case State::blockHeader:
+			if(!startBlock()) {
+				state = State::error;
+			}
+			break;
+
+		case State::stored: {
+			if(storedRemaining == 0) {
+				state = State::blockHeader;
+				break;
+			}
+			uint8_t c = getBits(8);
+			if(state == State::error) {
+				break;
+			}
+			put(c);
+			if(buffer != nullptr) {
+				buffer[n] = c;
+			}
+			++n;
+			--storedRemaining;
+			break;
+		}
+
+		case State::huffman: {
+			int symbol = decodeSymbol(litTree);
+			if(symbol < 0 || state == State::error) {
+				state = State::error;
+			} else if(symbol < 256) {
+				put(symbol);
+				if(buffer != nullptr) {
+					buffer[n] = symbol;
+				}
+				++n;
+			} else if(symbol == 256) {
+				state = State::blockHeader;
+			} else if(!startMatch(symbol) || state == State::error) {
+				matchLength = 0;
+				state = State::error;
+			}
+			break;
+		}
+
+		case State::done:
+		case State::error:
+		default:
+			return n;
+		}
+	}
+
+	return n;
+}
+
+} // namespace FSTR
@@ -0,0 +1,94 @@
+/**
+ * MultiStream.cpp
+ *
+ * Copyright 2019 mikee47 <mike@sillyhouse.net>
+ *
+ * This file is part of the FlashString Library
+ *
+ * This library is free software: you can redistribute it and/or modify it under the terms of the
+ * GNU General Public License as published by the Free Software Foundation, version 3 or later.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with FlashString.
+ * If not, see <https://www.gnu.org/licenses/>.
+ *
+ ****/
+
+#include "include/FlashString/MultiStream.hpp"
+
+namespace FSTR
+{
+MultiStream::MultiStream(const ObjectBase& list, unsigned listLength, GetString getString, bool flashread)
+	: list(list), getString(getString), listLength(listLength), flashread(flashread)
+{
+	for(unsigned i = 0; i < listLength; ++i) {
+		length += getString(list, i).length();
+	}
+	seekFrom(0, SEEK_SET);
+}
+
+uint16_t MultiStream::readMemoryBlock(char* data, int bufSize)
+{
+	size_t count = 0;
+	auto index = segment;
+	auto start = segmentStart;
+	while(bufSize > 0 && count < size_t(bufSize) && index < listLength) {
+		auto& str = getString(list, index);
+		auto offset = readPos + count - start;
+		auto len = str.length();
+		if(offset >= len) {
+			start += len;
+			++index;
+			continue;
+		}
+		auto n = bufSize - count;
+		count += flashread ? str.readFlash(offset, data + count, n) : str.read(offset, data + count, n);
+	}
+
+	return count;
+}
+
+int MultiStream::seekFrom(int offset, unsigned origin)
+{
+	size_t newPos;
+	switch(origin) {
+	case SEEK_SET:
+		newPos = offset;
+		break;
+	case SEEK_CUR:
+		newPos = readPos + offset;
+		break;
+	case SEEK_END:
+		newPos = length + offset;
+		break;
+	default:
+		return -1;
+	}
+
+	if(newPos > length) {
+		return -1;
+	}
+
+	if(newPos < segmentStart) {
+		segment = 0;
+		segmentStart = 0;
+	}
+
+	// Skip to the String containing the new position, ignoring any which are empty
+	while(segment < listLength) {
+		auto len = getString(list, segment).length();
+		if(newPos < segmentStart + len) {
+			break;
+		}
+		segmentStart += len;
+		++segment;
+	}
+
+	readPos = newPos;
+	return readPos;
+}
+
+} // namespace FSTR
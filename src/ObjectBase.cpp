@@ -24,6 +24,9 @@ namespace FSTR
 {
 const ObjectBase ObjectBase::empty_{ObjectBase::lengthInvalid};
 constexpr uint32_t ObjectBase::copyBit;
+constexpr uint32_t ObjectBase::sliceMarker;
+constexpr uint32_t ObjectBase::hashBit;
+constexpr uint32_t ObjectBase::maxLength;
 
 size_t ObjectBase::readFlash(size_t offset, void* buffer, size_t count) const
 {
@@ -41,36 +44,141 @@ size_t ObjectBase::length() const
 {
 	if(isNull()) {
 		return 0;
+	} else if(isSlice()) {
+		return getSlice().length;
 	} else if(isCopy()) {
 		return reinterpret_cast<const ObjectBase*>(flashLength_ & ~copyBit)->length();
 	} else {
-		return flashLength_;
+		return decodeLength(flashLength_);
 	}
 }
 
 const uint8_t* ObjectBase::data() const
+{
+	size_t length;
+	return resolve(length);
+}
+
+const uint8_t* ObjectBase::resolve(size_t& length) const
 {
 	if(isNull()) {
+		length = 0;
 		// Return a pointer to a valid memory location
 		return reinterpret_cast<const uint8_t*>(&flashLength_);
 	}
 
 	auto ptr = this;
 
-	if(isCopy()) {
+	if(isCopy() && !isSlice()) {
 		// Get real object
 		ptr = reinterpret_cast<const ObjectBase*>(flashLength_ & ~copyBit);
 	}
 
+	if(ptr->isSlice()) {
+		// Slice always refers to a real object, and the range has already been checked
+		auto& slice = ptr->getSlice();
+		length = slice.length;
+		return reinterpret_cast<const uint8_t*>(&slice.object->flashLength_ + 1) + slice.offset;
+	}
+
 	// Cannot yet differentiate memory addresses on Host
 #ifndef ARCH_HOST
 	// Check we've got a real flash pointer
 	assert(isFlashPtr(ptr));
 #endif
 
+	// A copy always refers to a real object
+	length = decodeLength(ptr->flashLength_);
 	return reinterpret_cast<const uint8_t*>(&ptr->flashLength_ + 1);
 }
 
+ContentHash ObjectBase::contentHash() const
+{
+	ContentHash hash{};
+	if(isNull() || isSlice()) {
+		return hash;
+	}
+
+	auto ptr = this;
+	if(isCopy()) {
+		ptr = reinterpret_cast<const ObjectBase*>(flashLength_ & ~copyBit);
+		if(ptr->isSlice()) {
+			return hash;
+		}
+	}
+
+	if(ptr->flashLength_ & hashBit) {
+		memcpy_P(&hash, reinterpret_cast<const ContentHash*>(ptr) - 1, sizeof(hash));
+		// Hash file is out of date
+		if(hash.length != ptr->length()) {
+			hash = ContentHash{};
+		}
+	}
+	return hash;
+}
+
+const ObjectBase* ObjectBase::flashObject() const
+{
+	if(isNull()) {
+		return nullptr;
+	}
+
+	auto ptr = this;
+	if(isCopy() && !isSlice()) {
+		ptr = reinterpret_cast<const ObjectBase*>(flashLength_ & ~copyBit);
+	}
+
+	return ptr->isSlice() ? ptr->getSlice().object : ptr;
+}
+
+Type ObjectBase::type() const
+{
+	auto ptr = flashObject();
+	if(ptr == nullptr) {
+		return Type::Unknown;
+	}
+
+	return Type((ptr->flashLength_ >> typeShift) & uint32_t(Type::MaxType));
+}
+
+size_t ObjectBase::elementSize() const
+{
+	auto ptr = flashObject();
+	if(ptr == nullptr) {
+		return 0;
+	}
+
+	return decodeElementSize((ptr->flashLength_ >> elementSizeShift) & 0x07);
+}
+
+void ObjectBase::initSlice(SliceData& slice, const ObjectBase& obj, size_t offset, size_t length)
+{
+	auto src = &obj;
+	if(src->isCopy() && !src->isSlice() && !src->isNull()) {
+		src = reinterpret_cast<const ObjectBase*>(src->flashLength_ & ~copyBit);
+	}
+
+	if(src->isNull()) {
+		slice = SliceData{&empty_, 0, 0};
+		flashLength_ = lengthInvalid;
+		return;
+	}
+
+	auto srcLength = src->length();
+	offset = std::min(offset, srcLength);
+	length = std::min(length, srcLength - offset);
+
+	if(src->isSlice()) {
+		// Refer directly to the real object
+		auto& srcSlice = src->getSlice();
+		slice = SliceData{srcSlice.object, uint32_t(srcSlice.offset + offset), uint32_t(length)};
+	} else {
+		slice = SliceData{src, uint32_t(offset), uint32_t(length)};
+	}
+
+	flashLength_ = sliceMarker;
+}
+
 void ObjectBase::invalidate()
 {
 #ifndef ARCH_HOST
@@ -0,0 +1,85 @@
+/**
+ * Print.cpp
+ *
+ * Copyright 2019 mikee47 <mike@sillyhouse.net>
+ *
+ * This file is part of the FlashString Library
+ *
+ * This library is free software: you can redistribute it and/or modify it under the terms of the
+ * GNU General Public License as published by the Free Software Foundation, version 3 or later.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with FlashString.
+ * If not, see <https://www.gnu.org/licenses/>.
+ *
+ ****/
+
+#include "include/FlashString/Print.hpp"
+
+namespace FSTR
+{
+namespace
+{
+size_t printDigits(Print& p, uint64_t value, bool negative, const PrintFormat& format)
+{
+	unsigned base = format.base;
+	if(base < 2 || base > 16) {
+		base = 10;
+	}
+
+	// Enough for 64 binary digits plus sign, built from the end
+	char buffer[66];
+	auto end = &buffer[sizeof(buffer)];
+	auto ptr = end;
+	do {
+		unsigned digit = value % base;
+		value /= base;
+		*--ptr = (digit < 10) ? ('0' + digit) : ('a' + digit - 10);
+	} while(value != 0);
+
+	auto width = std::min(size_t(format.width), sizeof(buffer) - 1);
+	while(size_t(end - ptr) < width) {
+		*--ptr = '0';
+	}
+
+	if(negative) {
+		*--ptr = '-';
+	}
+
+	return p.write(ptr, end - ptr);
+}
+
+} // namespace
+
+size_t printText(Print& p, const char* text)
+{
+	if(text == nullptr) {
+		return 0;
+	}
+
+	auto len = strlen_P(text);
+	if(len == 0) {
+		return 0;
+	}
+
+	char buffer[len];
+	memcpy_P(buffer, text, len);
+	return p.write(buffer, len);
+}
+
+size_t printNumber(Print& p, uint64_t value, const PrintFormat& format)
+{
+	return printDigits(p, value, false, format);
+}
+
+size_t printNumber(Print& p, int64_t value, const PrintFormat& format)
+{
+	// Avoid overflow when negating the smallest value
+	return (value < 0) ? printDigits(p, uint64_t(-(value + 1)) + 1, true, format)
+					   : printDigits(p, uint64_t(value), false, format);
+}
+
+} // namespace FSTR
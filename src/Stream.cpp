@@ -23,13 +23,68 @@
 
 namespace FSTR
 {
+Stream::Stream(const CompressedObject& object, bool flashread) : object(object), length(0), flashread(flashread)
+{
+	CompressedObject::Header header;
+	if(object.getHeader(header)) {
+		start = CompressedObject::gzipOffset(header);
+		length = object.length() - start;
+		encoding = header.encoding;
+	}
+}
+
+bool Stream::setReadAhead(size_t blockSize)
+{
+	blockSize = ALIGNUP(blockSize);
+	bufferStart = bufferLength = 0;
+	if(blockSize == 0) {
+		buffer.reset();
+		bufferSize = 0;
+		return true;
+	}
+
+	// Reads start at a word-aligned position, so allow space for that
+	blockSize += sizeof(uint32_t);
+	buffer.reset(new char[blockSize]);
+	bufferSize = buffer ? blockSize : 0;
+	return bufferSize != 0;
+}
+
+void Stream::fillBuffer()
+{
+	bufferStart = readPos & ~(sizeof(uint32_t) - 1);
+	bufferLength = object.readFlash(start + bufferStart, buffer.get(), bufferSize);
+}
+
 uint16_t Stream::readMemoryBlock(char* data, int bufSize)
 {
-	if(flashread) {
-		return string.readFlash(readPos, data, bufSize);
-	} else {
-		return string.read(readPos, data, bufSize);
+	if(bufSize <= 0) {
+		return 0;
+	}
+
+	if(readPos >= length) {
+		return 0;
+	}
+
+	size_t count = std::min(size_t(bufSize), length - readPos);
+	if(!flashread) {
+		return object.read(start + readPos, data, count);
 	}
+
+	if(!buffer || count > bufferSize - sizeof(uint32_t)) {
+		return object.readFlash(start + readPos, data, count);
+	}
+
+	// Refill if any of the requested data is not in the buffer
+	auto bufferEnd = bufferStart + bufferLength;
+	if(readPos < bufferStart || readPos + count > bufferEnd) {
+		fillBuffer();
+		bufferEnd = bufferStart + bufferLength;
+	}
+
+	count = std::min(count, bufferEnd - readPos);
+	memcpy(data, &buffer[readPos - bufferStart], count);
+	return count;
 }
 
 int Stream::seekFrom(int offset, unsigned origin)
@@ -43,13 +98,13 @@ int Stream::seekFrom(int offset, unsigned origin)
 		newPos = readPos + offset;
 		break;
 	case SEEK_END:
-		newPos = string.length() + offset;
+		newPos = length + offset;
 		break;
 	default:
 		return -1;
 	}
 
-	if(newPos > string.length()) {
+	if(newPos > length) {
 		return -1;
 	}
 
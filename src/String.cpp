@@ -20,9 +20,92 @@
 #include "include/FlashString/String.hpp"
 #include <WString.h>
 #include <esp_spi_flash.h>
+#include <ctype.h>
 
 namespace FSTR
 {
+namespace
+{
+/*
+ * Convert any upper-case ASCII characters in a word to lower case, one byte lane at a time.
+ * Bit 7 of each lane is set if the character is in the range 'A' to 'Z', then shifted into bit 5.
+ */
+FSTR_INLINE uint32_t foldCase(uint32_t w)
+{
+	uint32_t lo = w & 0x7f7f7f7f;
+	uint32_t geA = lo + 0x3f3f3f3f; // Bit 7 set if >= 'A'
+	uint32_t gtZ = lo + 0x25252525; // Bit 7 set if > 'Z'
+	uint32_t upper = geA & ~gtZ & ~w & 0x80808080;
+	return w | (upper >> 2);
+}
+
+FSTR_INLINE uint32_t loadWord(const char* str, bool aligned)
+{
+	if(aligned) {
+		return *reinterpret_cast<const uint32_t*>(str);
+	}
+	uint32_t w;
+	memcpy(&w, str, sizeof(w));
+	return w;
+}
+
+/*
+ * Compare word-aligned String content with a buffer in RAM.
+ * Flash is accessed directly using aligned 32-bit reads, so no copy is required.
+ * The RAM buffer may have any alignment.
+ */
+bool alignedEquals(const void* flashData, const char* str, size_t length, bool ignoreCase)
+{
+	auto fp = static_cast<const uint32_t*>(flashData);
+	bool aligned = (uintptr_t(str) & 0x03) == 0;
+	for(; length >= sizeof(uint32_t); length -= sizeof(uint32_t), str += sizeof(uint32_t), ++fp) {
+		uint32_t w1 = pgm_read_dword(fp);
+		uint32_t w2 = loadWord(str, aligned);
+		if(w1 != w2 && (!ignoreCase || foldCase(w1) != foldCase(w2))) {
+			return false;
+		}
+	}
+
+	if(length == 0) {
+		return true;
+	}
+
+	// Compare only the remaining bytes
+	uint32_t tmp = pgm_read_dword(fp);
+	uint32_t w1{0};
+	uint32_t w2{0};
+	memcpy(&w1, &tmp, length);
+	memcpy(&w2, str, length);
+	return (w1 == w2) || (ignoreCase && foldCase(w1) == foldCase(w2));
+}
+
+/*
+ * Compare String content with a buffer in RAM.
+ * Content of a Slice may not be word-aligned, so is read in chunks.
+ */
+bool contentEquals(const void* flashData, const char* str, size_t length, bool ignoreCase)
+{
+	if(IS_ALIGNED(flashData)) {
+		return alignedEquals(flashData, str, length, ignoreCase);
+	}
+
+	auto fp = static_cast<const char*>(flashData);
+	char buf[64] __attribute__((aligned(4)));
+	while(length != 0) {
+		auto count = std::min(length, sizeof(buf));
+		memcpy_P(buf, fp, count);
+		if(!alignedEquals(buf, str, count, ignoreCase)) {
+			return false;
+		}
+		fp += count;
+		str += count;
+		length -= count;
+	}
+	return true;
+}
+
+} // namespace
+
 bool String::equals(const char* cstr, size_t len) const
 {
 	// Unlikely we'd want an empty flash string, but check anyway
@@ -36,19 +119,166 @@ bool String::equals(const char* cstr, size_t len) const
 	if(len != length()) {
 		return false;
 	}
-	LOAD_FSTR(buf, *this);
-	return memcmp(buf, cstr, len) == 0;
+	return contentEquals(data(), cstr, len, false);
+}
+
+bool String::equalsIgnoreCase(const char* cstr, size_t len) const
+{
+	if(cstr == nullptr) {
+		return length() == 0;
+	}
+	if(len == 0) {
+		len = strlen(cstr);
+	}
+	if(len != length()) {
+		return false;
+	}
+	return contentEquals(data(), cstr, len, true);
 }
 
 bool String::equals(const String& str) const
 {
-	if(data() == str.data()) {
+	size_t len;
+	auto ptr = resolve(len);
+	size_t strLength;
+	auto strPtr = str.resolve(strLength);
+	// Slices may share data but differ in length
+	if(len != strLength) {
+		return false;
+	}
+	if(ptr == strPtr) {
 		return true;
 	}
-	if(length() != str.length()) {
-		return false;
+	if(IS_ALIGNED(ptr) && IS_ALIGNED(strPtr)) {
+		return memcmp_aligned(ptr, strPtr, len) == 0;
+	}
+
+	char buf[64] __attribute__((aligned(4)));
+	for(size_t offset = 0; offset < len; offset += sizeof(buf)) {
+		auto count = std::min(len - offset, sizeof(buf));
+		memcpy_P(buf, strPtr + offset, count);
+		if(!contentEquals(ptr + offset, buf, count, false)) {
+			return false;
+		}
 	}
-	return memcmp_aligned(data(), str.data(), length()) == 0;
+	return true;
+}
+
+int String::compare(const char* cstr, size_t len, bool ignoreCase) const
+{
+	auto thisLength = length();
+	auto cmpLength = std::min(thisLength, len);
+	char buf[64] __attribute__((aligned(4)));
+	size_t offset = 0;
+	while(offset < cmpLength) {
+		auto count = read(offset, buf, std::min(cmpLength - offset, sizeof(buf)));
+		for(unsigned i = 0; i < count; ++i) {
+			int c1 = uint8_t(buf[i]);
+			int c2 = uint8_t(cstr[offset + i]);
+			if(ignoreCase) {
+				c1 = tolower(c1);
+				c2 = tolower(c2);
+			}
+			if(c1 != c2) {
+				return c1 - c2;
+			}
+		}
+		offset += count;
+	}
+
+	if(thisLength == len) {
+		return 0;
+	}
+	return (thisLength < len) ? -1 : 1;
+}
+
+bool String::matchAt(size_t offset, const char* str, size_t length) const
+{
+	char buf[64] __attribute__((aligned(4)));
+	while(length != 0) {
+		auto count = readFlash(offset, buf, std::min(length, sizeof(buf)));
+		if(count == 0 || memcmp(buf, str, count) != 0) {
+			return false;
+		}
+		offset += count;
+		str += count;
+		length -= count;
+	}
+	return true;
+}
+
+int String::indexOf(const char* needle, size_t needleLength, size_t fromIndex) const
+{
+	if(needle == nullptr) {
+		needleLength = 0;
+	}
+	auto len = length();
+	if(fromIndex > len || needleLength > len - fromIndex) {
+		return -1;
+	}
+	if(needleLength == 0) {
+		return fromIndex;
+	}
+
+	// Position of last possible match
+	auto last = len - needleLength;
+	char buf[64] __attribute__((aligned(4)));
+	auto offset = fromIndex;
+	while(offset <= last) {
+		// Text following the candidates is used to confirm matches without re-reading flash
+		auto count = readFlash(offset, buf, sizeof(buf));
+		auto candidates = std::min(count, last - offset + 1);
+		auto end = buf + candidates;
+		auto p = buf;
+		while((p = static_cast<char*>(memchr(p, needle[0], end - p))) != nullptr) {
+			size_t avail = buf + count - p;
+			if(memcmp(p, needle, std::min(avail, needleLength)) == 0 &&
+			   (avail >= needleLength ||
+				matchAt(offset + count, needle + avail, needleLength - avail))) {
+				return offset + (p - buf);
+			}
+			++p;
+		}
+		offset += candidates;
+	}
+
+	return -1;
+}
+
+int String::lastIndexOf(const char* needle, size_t needleLength, size_t fromIndex) const
+{
+	if(needle == nullptr) {
+		needleLength = 0;
+	}
+	auto len = length();
+	if(needleLength > len) {
+		return -1;
+	}
+	auto last = std::min(fromIndex, len - needleLength);
+	if(needleLength == 0) {
+		return last;
+	}
+
+	// Work backwards through the content, one chunk of candidate positions at a time
+	char buf[64] __attribute__((aligned(4)));
+	auto end = last + 1;
+	while(end != 0) {
+		auto start = end - std::min(end, sizeof(buf));
+		auto count = readFlash(start, buf, sizeof(buf));
+		for(auto i = end - start; i-- != 0;) {
+			if(buf[i] != needle[0]) {
+				continue;
+			}
+			size_t avail = count - i;
+			if(memcmp(&buf[i], needle, std::min(avail, needleLength)) == 0 &&
+			   (avail >= needleLength || matchAt(start + count, needle + avail, needleLength - avail))) {
+				return start + i;
+			}
+		}
+		end = start;
+	}
+
+	return -1;
 }
 
 /* Wiring String support */
@@ -64,9 +294,7 @@ bool String::equals(const WString& str) const
 	if(len != length()) {
 		return false;
 	}
-	// @todo optimise memcmp_P then we won't need to load entire String into RAM first
-	LOAD_FSTR(buf, *this);
-	return memcmp(buf, str.c_str(), len) == 0;
+	return contentEquals(data(), str.c_str(), len, false);
 }
 
 bool String::equalsIgnoreCase(const WString& str) const
@@ -75,8 +303,27 @@ bool String::equalsIgnoreCase(const WString& str) const
 	if(len != length()) {
 		return false;
 	}
-	LOAD_FSTR(buf, *this);
-	return memicmp(buf, str.c_str(), len) == 0;
+	return contentEquals(data(), str.c_str(), len, true);
+}
+
+int String::indexOf(const WString& needle, size_t fromIndex) const
+{
+	return indexOf(needle.c_str(), needle.length(), fromIndex);
+}
+
+int String::lastIndexOf(const WString& needle, size_t fromIndex) const
+{
+	return lastIndexOf(needle.c_str(), needle.length(), fromIndex);
+}
+
+bool String::startsWith(const WString& prefix) const
+{
+	return startsWith(prefix.c_str(), prefix.length());
+}
+
+bool String::endsWith(const WString& suffix) const
+{
+	return endsWith(suffix.c_str(), suffix.length());
 }
 
 } // namespace FSTR
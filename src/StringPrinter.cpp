@@ -20,22 +20,36 @@
 #include "include/FlashString/StringPrinter.hpp"
 #include "include/FlashString/String.hpp"
 #include <Print.h>
+#include <esp_spi_flash.h>
 
 namespace FSTR
 {
 size_t StringPrinter::printTo(Print& p) const
 {
-	// Print in chunks
-	char buffer[256];
+	auto view = string.view();
+	auto length = view.length();
+	if(length == 0) {
+		return 0;
+	}
+
+	if(chunkSize == directWrite) {
+		return p.write(view.data(), length);
+	}
+
+	// Print in chunks, using a buffer no larger than required
+	auto bufSize = std::min(chunkSize, length);
+	char buffer[bufSize];
+	// For small Strings, read via cache
+	bool cached = (length <= cacheThreshold);
 	size_t offset = 0;
 	size_t totalWriteCount = 0;
-	size_t readCount;
-	// For small Strings, read via cache
-	if(string.length() <= 64) {
-		readCount = string.read(0, buffer, sizeof(buffer));
-		return p.write(buffer, readCount);
-	}
-	while((readCount = string.readFlash(offset, buffer, sizeof(buffer))) > 0) {
+	while(offset < length) {
+		auto readCount = std::min(bufSize, length - offset);
+		if(cached) {
+			memcpy_P(buffer, view.data() + offset, readCount);
+		} else {
+			flashmem_read(buffer, flashmem_get_address(view.data() + offset), readCount);
+		}
 		auto writeCount = p.write(buffer, readCount);
 		totalWriteCount += writeCount;
 		if(writeCount != readCount) {
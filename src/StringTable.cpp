@@ -0,0 +1,92 @@
+/**
+ * StringTable.cpp
+ *
+ * Copyright 2019 mikee47 <mike@sillyhouse.net>
+ *
+ * This file is part of the FlashString Library
+ *
+ * This library is free software: you can redistribute it and/or modify it under the terms of the
+ * GNU General Public License as published by the Free Software Foundation, version 3 or later.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with FlashString.
+ * If not, see <https://www.gnu.org/licenses/>.
+ *
+ ****/
+
+#include "include/FlashString/StringTable.hpp"
+
+namespace FSTR
+{
+constexpr unsigned StringTable::entryOffsetBits;
+
+Slice<String> StringTable::valueAt(unsigned index) const
+{
+	size_t offset;
+	size_t length;
+	if(!getEntry(isMerged(), index, offset, length)) {
+		return Slice<String>(String::empty(), 0, 0);
+	}
+
+	return Slice<String>(*this, offset, length);
+}
+
+int StringTable::indexOf(const char* str, size_t length, bool ignoreCase) const
+{
+	if(str == nullptr) {
+		length = 0;
+	}
+
+	bool merged = isMerged();
+	auto n = getCount(merged);
+	for(unsigned i = 0; i < n; ++i) {
+		size_t offset;
+		size_t len;
+		getEntry(merged, i, offset, len);
+		if(len != length) {
+			continue;
+		}
+		// Zero-length arguments are taken as NUL-terminated, so check here
+		if(length == 0) {
+			return i;
+		}
+		Slice<String> s(*this, offset, len);
+		if(ignoreCase ? s.equalsIgnoreCase(str, length) : s.equals(str, length)) {
+			return i;
+		}
+	}
+
+	return -1;
+}
+
+size_t StringTable::getCount(bool merged) const
+{
+	if(merged) {
+		return (length() < sizeof(uint32_t)) ? 0 : readIndex<uint32_t>(0);
+	}
+
+	return (length() < 2 * sizeof(uint16_t)) ? 0 : readIndex<uint16_t>(0) / sizeof(uint16_t) - 1;
+}
+
+bool StringTable::getEntry(bool merged, unsigned index, size_t& offset, size_t& length) const
+{
+	if(index >= getCount(merged)) {
+		return false;
+	}
+
+	if(merged) {
+		auto entry = readIndex<uint32_t>(1 + index);
+		offset = entry & ((1U << entryOffsetBits) - 1);
+		length = entry >> entryOffsetBits;
+	} else {
+		offset = readIndex<uint16_t>(index);
+		length = readIndex<uint16_t>(index + 1) - offset;
+	}
+
+	return true;
+}
+
+} // namespace FSTR
@@ -0,0 +1,185 @@
+/**
+ * Trie.cpp
+ *
+ * Copyright 2019 mikee47 <mike@sillyhouse.net>
+ *
+ * This file is part of the FlashString Library
+ *
+ * This library is free software: you can redistribute it and/or modify it under the terms of the
+ * GNU General Public License as published by the Free Software Foundation, version 3 or later.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with FlashString.
+ * If not, see <https://www.gnu.org/licenses/>.
+ *
+ ****/
+
+#include "include/FlashString/Trie.hpp"
+#include "include/FlashString/Hash.hpp"
+
+namespace FSTR
+{
+/*
+ * Node layout helpers. All offsets are relative to the start of the trie content.
+ */
+namespace
+{
+/*
+ * Offset of the node flags, following the label
+ */
+FSTR_INLINE unsigned flagsOffset(const uint8_t* data, unsigned node)
+{
+	return node + 1 + pgm_read_byte(&data[node]);
+}
+
+FSTR_INLINE bool isTerminal(const uint8_t* data, unsigned node)
+{
+	return (pgm_read_byte(&data[flagsOffset(data, node)]) & Trie::flagTerminal) != 0;
+}
+
+FSTR_INLINE unsigned nodeValue(const uint8_t* data, unsigned node)
+{
+	auto offset = flagsOffset(data, node) + 1;
+	return pgm_read_byte(&data[offset]) | (pgm_read_byte(&data[offset + 1]) << 8);
+}
+
+/*
+ * Offset of the childCount field
+ */
+FSTR_INLINE unsigned childrenOffset(const uint8_t* data, unsigned node)
+{
+	auto offset = flagsOffset(data, node);
+	return offset + (isTerminal(data, node) ? 3 : 1);
+}
+
+FSTR_INLINE unsigned childOffset(const uint8_t* data, unsigned entry)
+{
+	return pgm_read_byte(&data[entry + 1]) | (pgm_read_byte(&data[entry + 2]) << 8) |
+		   (pgm_read_byte(&data[entry + 3]) << 16);
+}
+
+} // namespace
+
+size_t Trie::matchLabel(unsigned offset, const char* str, size_t length, bool ignoreCase) const
+{
+	auto p = data();
+	size_t labelLength = pgm_read_byte(&p[offset]);
+	auto label = &p[offset + 1];
+	size_t count = std::min(labelLength, length);
+	for(size_t i = 0; i < count; ++i) {
+		uint8_t c = str[i];
+		if(ignoreCase) {
+			c = Hash::foldCase(c);
+		}
+		if(pgm_read_byte(&label[i]) != c) {
+			return i;
+		}
+	}
+	return count;
+}
+
+unsigned Trie::findChild(unsigned offset, uint8_t c) const
+{
+	auto p = data();
+	auto entry = childrenOffset(p, offset);
+	unsigned count = pgm_read_byte(&p[entry++]);
+	for(; count != 0; --count, entry += 4) {
+		uint8_t firstChar = pgm_read_byte(&p[entry]);
+		if(firstChar == c) {
+			return childOffset(p, entry);
+		}
+		if(firstChar > c) {
+			break;
+		}
+	}
+	return 0;
+}
+
+int Trie::firstValue(unsigned offset) const
+{
+	auto p = data();
+	while(!isTerminal(p, offset)) {
+		auto entry = childrenOffset(p, offset);
+		if(pgm_read_byte(&p[entry]) == 0) {
+			return -1;
+		}
+		offset = childOffset(p, entry + 1);
+	}
+	return nodeValue(p, offset);
+}
+
+int Trie::longestPrefix(const char* str, size_t length, size_t* matchLength) const
+{
+	if(this->length() <= headerSize) {
+		return -1;
+	}
+	if(str == nullptr) {
+		length = 0;
+	}
+
+	auto p = data();
+	bool fold = ignoreCase();
+	int result = -1;
+	size_t pos = 0;
+	unsigned node = headerSize;
+	for(;;) {
+		size_t labelLength = pgm_read_byte(&p[node]);
+		if(matchLabel(node, &str[pos], length - pos, fold) != labelLength) {
+			break;
+		}
+		pos += labelLength;
+		if(isTerminal(p, node)) {
+			result = nodeValue(p, node);
+			if(matchLength != nullptr) {
+				*matchLength = pos;
+			}
+		}
+		if(pos == length) {
+			break;
+		}
+		uint8_t c = str[pos];
+		node = findChild(node, fold ? Hash::foldCase(c) : c);
+		if(node == 0) {
+			break;
+		}
+	}
+
+	return result;
+}
+
+int Trie::startsWith(const char* prefix, size_t length) const
+{
+	if(this->length() <= headerSize) {
+		return -1;
+	}
+	if(prefix == nullptr) {
+		length = 0;
+	}
+
+	auto p = data();
+	bool fold = ignoreCase();
+	size_t pos = 0;
+	unsigned node = headerSize;
+	for(;;) {
+		size_t labelLength = pgm_read_byte(&p[node]);
+		auto count = matchLabel(node, &prefix[pos], length - pos, fold);
+		pos += count;
+		if(pos == length) {
+			// Prefix ends within or at end of this node
+			return firstValue(node);
+		}
+		if(count != labelLength) {
+			return -1;
+		}
+		uint8_t c = prefix[pos];
+		node = findChild(node, fold ? Hash::foldCase(c) : c);
+		if(node == 0) {
+			return -1;
+		}
+	}
+}
+
+} // namespace FSTR
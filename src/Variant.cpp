@@ -0,0 +1,161 @@
+/**
+ * Variant.cpp
+ *
+ * Copyright 2019 mikee47 <mike@sillyhouse.net>
+ *
+ * This file is part of the FlashString Library
+ *
+ * This library is free software: you can redistribute it and/or modify it under the terms of the
+ * GNU General Public License as published by the Free Software Foundation, version 3 or later.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with FlashString.
+ * If not, see <https://www.gnu.org/licenses/>.
+ *
+ ****/
+
+#include "include/FlashString/Variant.hpp"
+#include "include/FlashString/Map.hpp"
+
+namespace FSTR
+{
+namespace
+{
+template <typename T> size_t printArray(Print& p, const ObjectBase& object)
+{
+	return object.as<Array<T>>().printTo(p);
+}
+
+template <typename T8, typename T16, typename T32, typename T64>
+size_t printIntArray(Print& p, const ObjectBase& object, size_t elementSize)
+{
+	switch(elementSize) {
+	case 1:
+		return printArray<T8>(p, object);
+	case 2:
+		return printArray<T16>(p, object);
+	case 4:
+		return printArray<T32>(p, object);
+	case 8:
+		return printArray<T64>(p, object);
+	default:
+		return 0;
+	}
+}
+
+} // namespace
+
+size_t Variant::length() const
+{
+	if(isNull()) {
+		return 0;
+	}
+
+	if(isString()) {
+		return object->length();
+	}
+
+	// Element size describes the index layout, not the content
+	if(type() == Type::StringTable) {
+		return 0;
+	}
+
+	auto elementSize = object->ObjectBase::elementSize();
+	return (elementSize == 0) ? 0 : object->length() / elementSize;
+}
+
+const ObjectBase* Variant::readPointer(size_t offset) const
+{
+	const ObjectBase* ptr;
+	memcpy_P(&ptr, object->data() + offset, sizeof(ptr));
+	return ptr;
+}
+
+Variant Variant::valueAt(unsigned index) const
+{
+	auto t = type();
+	if(t != Type::Vector && !isMap()) {
+		return Variant();
+	}
+
+	if(index >= length()) {
+		return Variant();
+	}
+
+	auto elementSize = object->ObjectBase::elementSize();
+	auto offset = index * elementSize;
+	switch(t) {
+	case Type::Vector:
+		return Variant(readPointer(offset), nullptr);
+
+	case Type::Map:
+		// Pair contains key and content pointers
+		return Variant(readPointer(offset + elementSize / 2), reinterpret_cast<const String*>(readPointer(offset)));
+
+	case Type::HashedMap:
+		// Key and content pointers are followed by the key hash
+		return Variant(readPointer(offset + sizeof(void*)), reinterpret_cast<const String*>(readPointer(offset)));
+
+	default:
+		// Keys may be of any integral type, with content pointer in the second half of the pair
+		return Variant(readPointer(offset + elementSize / 2), nullptr);
+	}
+}
+
+Variant Variant::get(const char* key, size_t keyLength) const
+{
+	if(key == nullptr) {
+		keyLength = 0;
+	}
+
+	switch(type()) {
+	case Type::Map: {
+		auto len = length();
+		for(unsigned i = 0; i < len; ++i) {
+			auto value = valueAt(i);
+			auto& k = value.key();
+			if(k.length() == keyLength && k.compare(key, keyLength, true) == 0) {
+				return value;
+			}
+		}
+		return Variant();
+	}
+
+	case Type::HashedMap: {
+		// Use stored key hashes
+		int i = object->as<HashedMap<String>>().indexOf(key, keyLength);
+		return (i < 0) ? Variant() : valueAt(i);
+	}
+
+	default:
+		return Variant();
+	}
+}
+
+size_t Variant::printTo(Print& p) const
+{
+	if(isNull()) {
+		return 0;
+	}
+
+	auto elementSize = object->ObjectBase::elementSize();
+	switch(type()) {
+	case Type::String:
+		return object->as<String>().printTo(p);
+	case Type::Signed:
+		return printIntArray<int8_t, int16_t, int32_t, int64_t>(p, *object, elementSize);
+	case Type::Unsigned:
+		return printIntArray<uint8_t, uint16_t, uint32_t, uint64_t>(p, *object, elementSize);
+	case Type::Float:
+		return (elementSize == sizeof(float)) ? printArray<float>(p, *object) : printArray<double>(p, *object);
+	case Type::Bool:
+		return printArray<bool>(p, *object);
+	default:
+		return 0;
+	}
+}
+
+} // namespace FSTR
@@ -22,6 +22,7 @@
 #pragma once
 
 #include "Object.hpp"
+#include "Slice.hpp"
 #include "ArrayPrinter.hpp"
 
 /**
@@ -63,7 +64,9 @@
 	constexpr const struct {                                                                                           \
 		FSTR::ObjectBase object;                                                                                       \
 		ElementType data[sizeof((const ElementType[]){__VA_ARGS__}) / sizeof(ElementType)];                            \
-	} FSTR_PACKED name PROGMEM = {{sizeof(name.data)}, {__VA_ARGS__}};                                                 \
+	} FSTR_PACKED name PROGMEM = {                                                                                     \
+		{FSTR::ObjectBase::encodeLength(FSTR::arrayType<ElementType>(), sizeof(ElementType), sizeof(name.data))},      \
+		{__VA_ARGS__}};                                                                                                \
 	FSTR_CHECK_STRUCT(name);
 
 /**
@@ -77,7 +80,7 @@
  */
 #define LOAD_FSTR_ARRAY(name, array)                                                                                   \
 	decltype(array)[0] name[(array).size()] __attribute__((aligned(4)));                                               \
-	memcpy_aligned(name, (array).data(), (array).size());
+	(array).read(0, name, (array).length());
 
 /**
  * @brief Define an Array and load it into a named buffer on the stack
@@ -104,13 +107,47 @@ namespace FSTR
 template <typename ElementType> class Array : public Object<Array<ElementType>, ElementType>
 {
 public:
+	/**
+	 * @brief Get part of the Array without copying it
+	 * @param start Index of first element
+	 * @param count Number of elements, default is to end of Array
+	 * @retval Slice<Array> Refers to the content of this Array, which must remain valid
+	 * @note Out-of-range values are clipped
+	 */
+	Slice<Array> slice(size_t start, size_t count = SIZE_MAX) const
+	{
+		auto len = this->length();
+		start = std::min(start, len);
+		count = std::min(count, len - start);
+		return Slice<Array>(*this, start * sizeof(ElementType), count * sizeof(ElementType));
+	}
+
 	/* Arduino Print support */
 
 	/**
 	 * @brief Returns a printer object for this array
+	 * @param format How to print the content
 	 * @note ElementType must be supported by Print
 	 */
-	ArrayPrinter<Array> printer(const WString& separator = ", ") const
+	ArrayPrinter<Array> printer(const PrintFormat& format = defaultArrayFormat) const
+	{
+		return ArrayPrinter<Array>(*this, format);
+	}
+
+	/**
+	 * @brief Returns a printer object for this array using default format with a different separator
+	 * @param separator May be stored in flash
+	 */
+	ArrayPrinter<Array> printer(const char* separator) const
+	{
+		return ArrayPrinter<Array>(*this, separator);
+	}
+
+	/**
+	 * @brief Returns a printer object using default format with a different separator
+	 * @param separator Copied into the printer
+	 */
+	ArrayPrinter<Array> printer(const WString& separator) const
 	{
 		return ArrayPrinter<Array>(*this, separator);
 	}
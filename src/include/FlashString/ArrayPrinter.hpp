@@ -20,6 +20,7 @@
 #pragma once
 
 #include "Print.hpp"
+#include <WString.h>
 
 namespace FSTR
 {
@@ -30,29 +31,52 @@ namespace FSTR
 template <class ArrayType> class ArrayPrinter : public Printable
 {
 public:
-	ArrayPrinter(const ArrayType& array, const WString& separator) : array(array), separator(separator)
+	ArrayPrinter(const ArrayType& array, const PrintFormat& format = defaultArrayFormat) : array(array), format(format)
 	{
 	}
 
+	ArrayPrinter(const ArrayType& array, const char* separator) : array(array), format(defaultArrayFormat)
+	{
+		format.separator = separator;
+	}
+
+	/**
+	 * @brief Constructor
+	 * @note The printer keeps its own copy of the separator
+	 */
+	ArrayPrinter(const ArrayType& array, const WString& separator)
+		: array(array), format(defaultArrayFormat), separatorText(separator)
+	{
+		format.separator = nullptr;
+	}
+
 	size_t printTo(Print& p) const override
 	{
+		auto fmt = format;
+		if(fmt.separator == nullptr) {
+			fmt.separator = separatorText.c_str();
+		}
+
 		size_t count = 0;
 
-		count += p.print("[");
-		for(unsigned i = 0; i < array.length(); ++i) {
-			if(i > 0) {
-				count += p.print(separator);
+		count += printText(p, fmt.prefix);
+		bool first = true;
+		for(auto&& value : array) {
+			if(!first) {
+				count += printText(p, fmt.separator);
 			}
-			count += print(p, array[i]);
+			first = false;
+			count += print(p, value, fmt);
 		}
-		count += p.print("]");
+		count += printText(p, fmt.suffix);
 
 		return count;
 	}
 
 private:
 	const ArrayType& array;
-	WString separator;
+	PrintFormat format;
+	WString separatorText;
 };
 
 } // namespace FSTR
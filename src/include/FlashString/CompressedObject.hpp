@@ -0,0 +1,147 @@
+/**
+ * CompressedObject.hpp - Defines the CompressedObject class and associated macros
+ *
+ * Copyright 2019 mikee47 <mike@sillyhouse.net>
+ *
+ * This file is part of the FlashString Library
+ *
+ * This library is free software: you can redistribute it and/or modify it under the terms of the
+ * GNU General Public License as published by the Free Software Foundation, version 3 or later.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with FlashString.
+ * If not, see <https://www.gnu.org/licenses/>.
+ *
+ ****/
+
+#pragma once
+
+#include "Object.hpp"
+
+/**
+ * @brief Define a CompressedObject containing data from an external file
+ * @param name Name for the object
+ * @param file Absolute path to the file, as produced by `tools/fscompress.py`
+ * @note Use `DECLARE_FSTR_COMPRESSED` to access the object from other translation units
+ */
+#define IMPORT_FSTR_COMPRESSED(name, file)                                                                             \
+	IMPORT_FSTR_DATA_TYPED(name, file, FSTR_IMPORT_TYPE_COMPRESSED)                                                    \
+	DECLARE_FSTR_COMPRESSED(name)
+
+/**
+ * @brief Declare an imported CompressedObject
+ * @param name
+ */
+#define DECLARE_FSTR_COMPRESSED(name) extern "C" const FSTR::CompressedObject name;
+
+namespace FSTR
+{
+/**
+ * @brief Compressed content stored in flash
+ * @note Content is produced by `tools/fscompress.py`. It consists of a `Header`, an optional block
+ * offset table, then a gzip stream (RFC 1952) with a fixed 10-byte header containing a single
+ * deflate stream (RFC 1951).
+ *
+ * If a block size is given when compressing, the content is split into blocks of that size which
+ * do not refer to any previous data. The offset table contains the position of each block within
+ * the deflate stream, relative to its start, so decompression can begin at any block.
+ * The gzip stream is still valid and can be sent to clients unchanged.
+ *
+ * Use a `DecompressStream` to read the original content, or `read()` for random access.
+ */
+class CompressedObject : public Object<CompressedObject, uint8_t>
+{
+public:
+	static constexpr uint32_t magic = 0x5a545346; ///< 'FSTZ'
+
+	/**
+	 * @brief Encoding of the compressed data
+	 */
+	enum class Encoding : uint8_t {
+		none,
+		gzip,
+	};
+
+	struct Header {
+		uint32_t magic;
+		uint32_t originalLength; ///< Length of uncompressed content
+		Encoding encoding;
+		uint8_t windowBits; ///< Window size used for compression, as a power of 2
+		uint16_t reserved;
+		uint32_t blockSize; ///< 0 if content is not block-compressed
+	};
+
+	static_assert(sizeof(Header) == 16, "Bad CompressedObject::Header");
+
+	/**
+	 * @brief Read the header
+	 * @param header On success, contains the header
+	 * @retval bool false if the object does not contain valid compressed data
+	 */
+	bool getHeader(Header& header) const;
+
+	/**
+	 * @brief Get the length of the uncompressed content
+	 * @retval size_t 0 if the object is not valid
+	 */
+	size_t originalLength() const
+	{
+		Header header;
+		return getHeader(header) ? header.originalLength : 0;
+	}
+
+	/**
+	 * @brief Read uncompressed content
+	 * @param offset Position in uncompressed content to start reading
+	 * @param buffer Where to store data
+	 * @param count How many bytes to read
+	 * @retval size_t Number of bytes actually read
+	 * @note Unlike other objects, this decompresses the requested data. Window and decoder buffers
+	 * are allocated on the heap for the duration of the call.
+	 * For block-compressed objects only the blocks containing the data are decompressed, otherwise
+	 * decompression must start at the beginning.
+	 */
+	size_t read(size_t offset, void* buffer, size_t count) const;
+
+	/**
+	 * @brief Get the number of entries in the block offset table
+	 */
+	static size_t getBlockCount(const Header& header)
+	{
+		return header.blockSize ? (header.originalLength + header.blockSize - 1) / header.blockSize : 0;
+	}
+
+	/**
+	 * @brief Get the offset of the gzip stream from the start of the object
+	 */
+	static size_t gzipOffset(const Header& header)
+	{
+		return sizeof(Header) + getBlockCount(header) * sizeof(uint32_t);
+	}
+
+	/**
+	 * @brief Get the offset of the deflate stream from the start of the object
+	 */
+	static size_t deflateOffset(const Header& header)
+	{
+		return gzipOffset(header) + gzipHeaderSize;
+	}
+
+	/**
+	 * @brief Find where to start decompressing to obtain a given position
+	 * @param header
+	 * @param position IN: Required position in uncompressed content, OUT: Start of containing block
+	 * @retval size_t Offset of deflate data for the block from start of object
+	 * @note If the object is not block-compressed then position is set to 0.
+	 */
+	size_t getBlockOffset(const Header& header, size_t& position) const;
+
+private:
+	static constexpr size_t gzipHeaderSize = 10;
+	static constexpr size_t gzipTrailerSize = 8;
+};
+
+} // namespace FSTR
@@ -0,0 +1,54 @@
+/**
+ * ContentHash.hpp - Defines the ContentHash structure
+ *
+ * Copyright 2019 mikee47 <mike@sillyhouse.net>
+ *
+ * This file is part of the FlashString Library
+ *
+ * This library is free software: you can redistribute it and/or modify it under the terms of the
+ * GNU General Public License as published by the Free Software Foundation, version 3 or later.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with FlashString.
+ * If not, see <https://www.gnu.org/licenses/>.
+ *
+ ****/
+
+#pragma once
+
+#include "config.hpp"
+
+namespace FSTR
+{
+/**
+ * @brief Hashes of object content, calculated at build time
+ * @note Produced by `tools/fshash.py` and imported with the object using `IMPORT_FSTR_HASHED`.
+ * It is stored in flash immediately before the object. Use `ObjectBase::contentHash()` to obtain it.
+ * The length of the hashed content is also recorded so that a stale hash file can be detected.
+ */
+struct ContentHash {
+	static constexpr uint32_t crc32Present = 0x01;
+	static constexpr uint32_t sha256Present = 0x02;
+
+	uint32_t crc32;		///< As used by zlib, gzip, etc.
+	uint8_t sha256[32]; ///< SHA-256 digest
+	uint32_t length;	///< Length of the hashed content
+	uint32_t flags;		///< Indicates which hashes are present, 0 if none
+
+	bool hasCrc32() const
+	{
+		return (flags & crc32Present) != 0;
+	}
+
+	bool hasSha256() const
+	{
+		return (flags & sha256Present) != 0;
+	}
+};
+
+static_assert(sizeof(ContentHash) == 44, "Bad ContentHash");
+
+} // namespace FSTR
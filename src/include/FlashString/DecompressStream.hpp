@@ -0,0 +1,95 @@
+/**
+ * DecompressStream.hpp - Defines the DecompressStream class
+ *
+ * Copyright 2019 mikee47 <mike@sillyhouse.net>
+ *
+ * This file is part of the FlashString Library
+ *
+ * This library is free software: you can redistribute it and/or modify it under the terms of the
+ * GNU General Public License as published by the Free Software Foundation, version 3 or later.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with FlashString.
+ * If not, see <https://www.gnu.org/licenses/>.
+ *
+ ****/
+
+#pragma once
+
+#include "CompressedObject.hpp"
+#include "Inflate.hpp"
+#include <Data/Stream/DataSourceStream.h>
+#include <memory>
+
+namespace FSTR
+{
+/** @addtogroup stream
+ *  @{
+ */
+
+/*
+ * Provides a read-only stream of the original content of a CompressedObject
+ */
+class DecompressStream : public IDataSourceStream
+{
+public:
+	/**
+	 * @brief Constructor
+	 * @param object
+	 * @note A window buffer is allocated on the heap, the size of which is set when the object is compressed.
+	 */
+	DecompressStream(const CompressedObject& object);
+
+	/**
+	 * @brief Determine if the stream was created successfully
+	 * @retval bool false if the object is invalid or the window could not be allocated
+	 */
+	bool isValid() const
+	{
+		return bool(window);
+	}
+
+	StreamType getStreamType() const override
+	{
+		return eSST_Memory;
+	}
+
+	int available() override
+	{
+		return header.originalLength - readPos;
+	}
+
+	/**
+	 * @brief Read decompressed data
+	 * @note The amount returned is limited by the window size
+	 */
+	uint16_t readMemoryBlock(char* data, int bufSize) override;
+
+	/**
+	 * @brief Change position in stream
+	 * @note Seeking outside the window requires decompression to restart. For block-compressed
+	 * objects this is from the start of the containing block, otherwise from the beginning.
+	 */
+	int seekFrom(int offset, unsigned origin) override;
+
+	bool isFinished() override
+	{
+		return readPos >= header.originalLength || inflate.isError();
+	}
+
+private:
+	const CompressedObject& object;
+	CompressedObject::Header header{};
+	size_t windowSize;
+	std::unique_ptr<uint8_t[]> window; ///< Contains the most recent output
+	Inflate inflate;
+	size_t base = 0;	///< Position in content where decompression was started
+	size_t readPos = 0; ///< Current read position, never more than windowSize behind the inflate output
+};
+
+/** @} */
+
+} // namespace FSTR
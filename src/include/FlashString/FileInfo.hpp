@@ -0,0 +1,58 @@
+/**
+ * FileInfo.hpp - Defines the FileInfo structure
+ *
+ * Copyright 2019 mikee47 <mike@sillyhouse.net>
+ *
+ * This file is part of the FlashString Library
+ *
+ * This library is free software: you can redistribute it and/or modify it under the terms of the
+ * GNU General Public License as published by the Free Software Foundation, version 3 or later.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with FlashString.
+ * If not, see <https://www.gnu.org/licenses/>.
+ *
+ ****/
+
+#pragma once
+
+#include "String.hpp"
+#include "CompressedObject.hpp"
+
+namespace FSTR
+{
+/**
+ * @brief Additional information about an entry in a file map
+ * @note File maps are produced by `tools/fsfiles.py`. This consists of a `SortedMap<String, String>`
+ * containing the file content, plus an `Array<FileInfo>` with an entry for each file, in the same order.
+ *
+ * The file size is the content length, and hashes (if generated) are obtained using `contentHash()`.
+ */
+struct FileInfo {
+	/**
+	 * @brief Get the MIME type of the file, e.g. "text/html"
+	 */
+	const String& mimeType() const
+	{
+		return (mimeType_ == nullptr) ? String::empty() : *mimeType_;
+	}
+
+	/**
+	 * @brief Get the compressed form of the file content
+	 * @retval CompressedObject& Null if the file is not stored in compressed form
+	 */
+	const CompressedObject& compressed() const
+	{
+		return (compressed_ == nullptr) ? CompressedObject::empty() : *compressed_;
+	}
+
+	/* Private member data */
+
+	const String* mimeType_;
+	const CompressedObject* compressed_;
+};
+
+} // namespace FSTR
@@ -0,0 +1,89 @@
+/**
+ * Hash.hpp - Hash functions shared by lookup indices and generator tools
+ *
+ * Copyright 2019 mikee47 <mike@sillyhouse.net>
+ *
+ * This file is part of the FlashString Library
+ *
+ * This library is free software: you can redistribute it and/or modify it under the terms of the
+ * GNU General Public License as published by the Free Software Foundation, version 3 or later.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with FlashString.
+ * If not, see <https://www.gnu.org/licenses/>.
+ *
+ ****/
+
+#pragma once
+
+#include "config.hpp"
+
+namespace FSTR
+{
+/**
+ * @brief Hash functions
+ * @note These must produce identical results to the generator tools in `tools/fsindex.py`
+ */
+namespace Hash
+{
+constexpr uint32_t fnvOffset = 2166136261U;
+constexpr uint32_t fnvPrime = 16777619U;
+
+/**
+ * @brief Fold an ASCII character to lower case
+ */
+constexpr uint8_t foldCase(uint8_t c)
+{
+	return (c >= 'A' && c <= 'Z') ? (c + 'a' - 'A') : c;
+}
+
+constexpr uint32_t xorShift(uint32_t h, unsigned shift)
+{
+	return h ^ (h >> shift);
+}
+
+/**
+ * @brief Murmur3 finalizer, used to improve distribution of the FNV hash
+ */
+constexpr uint32_t mix(uint32_t h)
+{
+	return xorShift(xorShift(xorShift(h, 16) * 0x85ebca6bU, 13) * 0xc2b2ae35U, 16);
+}
+
+constexpr uint32_t fnv(const char* data, size_t length, bool ignoreCase, uint32_t h)
+{
+	return (length == 0) ? h
+						 : fnv(data + 1, length - 1, ignoreCase,
+							   (h ^ (ignoreCase ? foldCase(uint8_t(*data)) : uint8_t(*data))) * fnvPrime);
+}
+
+/**
+ * @brief Calculate the hash of a string at compile time
+ * @param data
+ * @param length
+ * @param ignoreCase Fold ASCII letters to lower case before hashing
+ * @param seed Varies the hash output
+ * @retval uint32_t Same result as `calculate()`
+ * @note Recursion depth is one level per character, so only suitable for short strings such as keys
+ */
+constexpr uint32_t calculateConst(const char* data, size_t length, bool ignoreCase = false, uint32_t seed = 0)
+{
+	return mix(fnv(data, length, ignoreCase, fnvOffset ^ seed));
+}
+
+/**
+ * @brief Calculate the hash of a block of data in RAM
+ * @param data
+ * @param length
+ * @param ignoreCase Fold ASCII letters to lower case before hashing
+ * @param seed Varies the hash output
+ * @retval uint32_t
+ */
+uint32_t calculate(const void* data, size_t length, bool ignoreCase = false, uint32_t seed = 0);
+
+} // namespace Hash
+
+} // namespace FSTR
@@ -0,0 +1,111 @@
+/**
+ * HashIndex.hpp - Defines the HashIndex class and associated macros
+ *
+ * Copyright 2019 mikee47 <mike@sillyhouse.net>
+ *
+ * This file is part of the FlashString Library
+ *
+ * This library is free software: you can redistribute it and/or modify it under the terms of the
+ * GNU General Public License as published by the Free Software Foundation, version 3 or later.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with FlashString.
+ * If not, see <https://www.gnu.org/licenses/>.
+ *
+ ****/
+
+#pragma once
+
+#include "Array.hpp"
+#include "Hash.hpp"
+
+/**
+ * @brief Declare a global HashIndex& reference
+ * @param name
+ * @note Use `DEFINE_FSTR_HASH_INDEX` to instantiate the global Object
+ */
+#define DECLARE_FSTR_HASH_INDEX(name) extern const FSTR::HashIndex& name;
+
+/**
+ * @brief Define a HashIndex Object with global reference
+ * @param name Name of HashIndex& reference to define
+ * @param ... Table content, as produced by `tools/fsindex.py hash`
+ */
+#define DEFINE_FSTR_HASH_INDEX(name, ...)                                                                              \
+	static DEFINE_FSTR_ARRAY_DATA(FSTR_DATA_NAME(name), uint16_t, __VA_ARGS__);                                        \
+	DEFINE_FSTR_REF_NAMED(name, FSTR::HashIndex);
+
+/**
+ * @brief Define a HashIndex Object with local reference
+ * @param name Name of HashIndex& reference to define
+ * @param ... Table content, as produced by `tools/fsindex.py hash`
+ */
+#define DEFINE_FSTR_HASH_INDEX_LOCAL(name, ...)                                                                        \
+	static DEFINE_FSTR_ARRAY_DATA(FSTR_DATA_NAME(name), uint16_t, __VA_ARGS__);                                        \
+	static constexpr DEFINE_FSTR_REF_NAMED(name, FSTR::HashIndex);
+
+namespace FSTR
+{
+/**
+ * @brief A minimal perfect hash table for a set of String keys
+ * @note Table is generated at build time from a list of keys, which must be provided in the
+ * same order as the object being indexed (e.g. a Map). Content is an array of uint16_t values:
+ *
+ * 		seed, flags, bucketCount, displacement[bucketCount], slot[keyCount]
+ *
+ * A key hashes to a bucket, whose displacement value selects the slot containing
+ * the candidate index. The candidate must then be confirmed by comparing keys.
+ */
+class HashIndex : public Object<HashIndex, uint16_t>
+{
+public:
+	enum Flag {
+		flagIgnoreCase = 0x0001, ///< Keys are hashed ignoring case
+	};
+
+	/**
+	 * @brief Determine if the table was generated for case-insensitive lookups
+	 */
+	bool ignoreCase() const
+	{
+		return (valueAt(1) & flagIgnoreCase) != 0;
+	}
+
+	/**
+	 * @brief Get the number of keys in the table
+	 */
+	size_t keyCount() const
+	{
+		auto len = length();
+		return (len < headerSize) ? 0 : len - headerSize - valueAt(2);
+	}
+
+	/**
+	 * @brief Find the candidate index for a key
+	 * @param key
+	 * @param keyLength
+	 * @retval int Index to check, or -1 if table is empty.
+	 * The caller must compare keys to confirm a match.
+	 */
+	int find(const char* key, size_t keyLength) const
+	{
+		auto count = keyCount();
+		if(count == 0) {
+			return -1;
+		}
+		auto p = data();
+		auto bucketCount = readValue(&p[2]);
+		auto h = Hash::calculate(key, keyLength, ignoreCase(), readValue(&p[0]));
+		uint32_t d = readValue(&p[headerSize + h % bucketCount]);
+		auto slot = Hash::mix(h ^ (d * 0x9e3779b1U)) % count;
+		return readValue(&p[headerSize + bucketCount + slot]);
+	}
+
+private:
+	static constexpr unsigned headerSize = 3;
+};
+
+} // namespace FSTR
@@ -0,0 +1,129 @@
+/**
+ * HashedMapPair.hpp - Defines the HashedMapPair class template
+ *
+ * Copyright 2019 mikee47 <mike@sillyhouse.net>
+ *
+ * This file is part of the FlashString Library
+ *
+ * This library is free software: you can redistribute it and/or modify it under the terms of the
+ * GNU General Public License as published by the Free Software Foundation, version 3 or later.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with FlashString.
+ * If not, see <https://www.gnu.org/licenses/>.
+ *
+ ****/
+
+#pragma once
+
+#include "String.hpp"
+#include "Print.hpp"
+#include "Hash.hpp"
+#include <WString.h>
+
+/**
+ * @brief Calculate the hash for a String key at compile time
+ * @param key A String defined in the same translation unit using DEFINE_FSTR or DEFINE_FSTR_LOCAL
+ * @note Hash is case-insensitive so may be used for both types of lookup. Example:
+ *
+ *		DEFINE_FSTR_LOCAL(key1, "index.html");
+ *		DEFINE_FSTR_MAP_HASHED(fileMap, FSTR::String, {&key1, &content1, FSTR_KEY_HASH(key1)});
+ */
+#define FSTR_KEY_HASH(key)                                                                                             \
+	FSTR::Hash::calculateConst(FSTR_DATA_NAME(key).data,                                                               \
+							   FSTR::ObjectBase::decodeLength(FSTR_DATA_NAME(key).object.flashLength_), true)
+
+namespace FSTR
+{
+/**
+ * @brief describes a pair mapping String key => data, with a hash of the key
+ * @note The hash is used to reject mismatches without reading key content from flash
+ */
+template <class ContentType> class HashedMapPair
+{
+public:
+	typedef void (HashedMapPair::*IfHelperType)() const;
+	void IfHelper() const
+	{
+	}
+
+	/**
+	 * @brief Provides bool() operator to determine if Pair is valid
+	 */
+	operator IfHelperType() const
+	{
+		return content_ ? &HashedMapPair::IfHelper : 0;
+	}
+
+	/**
+	 * @brief Get an empty Pair object, identifies as invalid when lookup fails
+	 */
+	static const HashedMapPair empty()
+	{
+		return HashedMapPair{nullptr, nullptr, 0};
+	}
+
+	/**
+	 * @brief Get the key
+	 */
+	const String& key() const
+	{
+		return (key_ == nullptr) ? String::empty() : *key_;
+	}
+
+	/**
+	 * @brief Get the stored key hash
+	 */
+	uint32_t keyHash() const
+	{
+		return readValue(&hash_);
+	}
+
+	/**
+	 * @brief Accessor to get a reference to the content
+	 */
+	const ContentType& content() const
+	{
+		return (content_ == nullptr) ? ContentType::empty() : *content_;
+	}
+
+	operator const ContentType&() const
+	{
+		return content();
+	}
+
+	/* WString support */
+
+	explicit operator WString() const
+	{
+		return WString(content());
+	}
+
+	/* Print support */
+
+	size_t printTo(Print& p, const PrintFormat& format = defaultArrayFormat) const
+	{
+		size_t count = 0;
+
+		if(*this) {
+			count += print(p, key(), format);
+			count += p.print(" => ");
+			count += print(p, content(), format);
+		} else {
+			count += p.print("(invalid)");
+		}
+
+		return count;
+	}
+
+	/* Private member data */
+
+	const String* key_;
+	const ContentType* content_;
+	uint32_t hash_;
+};
+
+} // namespace FSTR
@@ -0,0 +1,106 @@
+/**
+ * IndexedTemplateStream.hpp - Defines the IndexedTemplateStream class
+ *
+ * Copyright 2019 mikee47 <mike@sillyhouse.net>
+ *
+ * This file is part of the FlashString Library
+ *
+ * This library is free software: you can redistribute it and/or modify it under the terms of the
+ * GNU General Public License as published by the Free Software Foundation, version 3 or later.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with FlashString.
+ * If not, see <https://www.gnu.org/licenses/>.
+ *
+ ****/
+
+#pragma once
+
+#include "String.hpp"
+#include "TemplateIndex.hpp"
+#include <Data/Stream/TemplateStream.h>
+
+namespace FSTR
+{
+/** @addtogroup stream
+ *  @{
+ */
+
+/*
+ * Template stream using a pre-built placeholder index
+ *
+ * Unlike TemplateStream, content is not scanned at runtime. Literal text between placeholders
+ * is read from flash in bulk, and placeholders are replaced as located by the index.
+ * As with TemplateStream, a placeholder with no value is output unchanged.
+ */
+class IndexedTemplateStream : public IDataSourceStream
+{
+public:
+	/**
+	 * @brief Constructor
+	 * @param content Template content
+	 * @param index Generated from the content using `tools/fsindex.py template`
+	 */
+	IndexedTemplateStream(const String& content, const TemplateIndex& index) : content(content), index(index)
+	{
+	}
+
+	void setVar(const WString& name, const WString& value)
+	{
+		vars[name] = value;
+	}
+
+	TemplateVariables& variables()
+	{
+		return vars;
+	}
+
+	StreamType getStreamType() const override
+	{
+		return eSST_Template;
+	}
+
+	uint16_t readMemoryBlock(char* data, int bufSize) override;
+
+	/**
+	 * @brief Change position in stream
+	 * @note Only forward seeks from the current position are supported
+	 */
+	int seekFrom(int offset, unsigned origin) override;
+
+	bool isFinished() override;
+
+protected:
+	/**
+	 * @brief Fetch the value for a placeholder
+	 * @param name
+	 * @retval WString Value to output, invalid to output the placeholder unchanged
+	 */
+	virtual WString getValue(const char* name);
+
+private:
+	void prepare();
+
+	size_t nextTagOffset() const
+	{
+		return (tagIndex < index.count()) ? index.getTag(tagIndex).offset : content.length();
+	}
+
+	const String& content;
+	const TemplateIndex& index;
+	TemplateVariables vars;
+	WString value;			///< Value for current placeholder
+	size_t readPos = 0;		///< Position in content
+	size_t valuePos = 0;	///< Position in value
+	size_t outputPos = 0;	///< Position in stream output
+	unsigned tagIndex = 0;	///< Next placeholder to process
+	bool prepared = false;	///< Set when state has been updated for current position
+	bool inValue = false;	///< Set when outputting a value
+};
+
+/** @} */
+
+} // namespace FSTR
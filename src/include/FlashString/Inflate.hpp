@@ -0,0 +1,141 @@
+/**
+ * Inflate.hpp - Decompressor for deflate data stored in flash
+ *
+ * Copyright 2019 mikee47 <mike@sillyhouse.net>
+ *
+ * This file is part of the FlashString Library
+ *
+ * This library is free software: you can redistribute it and/or modify it under the terms of the
+ * GNU General Public License as published by the Free Software Foundation, version 3 or later.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with FlashString.
+ * If not, see <https://www.gnu.org/licenses/>.
+ *
+ ****/
+
+#pragma once
+
+#include "ObjectBase.hpp"
+
+namespace FSTR
+{
+/**
+ * @brief Streaming decompressor for raw deflate data (RFC 1951) stored in an Object
+ * @note Output is produced on demand, in any amount. Back-references are resolved using
+ * a circular window buffer provided by the caller, which must be at least as large as
+ * the window used for compression.
+ *
+ * Compressed data is read from flash in small chunks using `readFlash()`.
+ */
+class Inflate
+{
+public:
+	/**
+	 * @brief Constructor
+	 * @param object Object containing the compressed data
+	 * @param window Buffer to store recent output
+	 * @param windowSize Size of window, must be a power of 2
+	 */
+	Inflate(const ObjectBase& object, uint8_t* window, size_t windowSize)
+		: object(object), window(window), windowMask(windowSize - 1)
+	{
+	}
+
+	/**
+	 * @brief Start decompressing from a given position
+	 * @param offset Offset of the deflate data from start of object
+	 * @note The window is reset, so the data must not refer back to any previous output.
+	 */
+	void begin(size_t offset);
+
+	/**
+	 * @brief Decompress data
+	 * @param buffer Where to write output, may be nullptr to just update the window
+	 * @param count Number of bytes required
+	 * @retval size_t Number of bytes produced. This is less than count only if the end of the
+	 * compressed data was reached or it is invalid.
+	 */
+	size_t read(uint8_t* buffer, size_t count);
+
+	/**
+	 * @brief Get the total number of bytes produced since calling `begin()`
+	 */
+	size_t getOutputPosition() const
+	{
+		return outPos;
+	}
+
+	bool isFinished() const
+	{
+		return state == State::done || state == State::error;
+	}
+
+	bool isError() const
+	{
+		return state == State::error;
+	}
+
+private:
+	enum class State : uint8_t {
+		blockHeader,
+		stored,
+		huffman,
+		done,
+		error,
+	};
+
+	/*
+	 * Canonical Huffman code, stored as number of codes of each length
+	 * followed by symbols in code order
+	 */
+	template <size_t symbolCount> struct Tree {
+		uint16_t counts[16];
+		uint16_t symbols[symbolCount];
+	};
+
+	static constexpr size_t maxLitCodes = 288;
+	static constexpr size_t maxDistCodes = 32;
+	using LitTree = Tree<maxLitCodes>;
+	using DistTree = Tree<maxDistCodes>;
+
+	uint8_t nextByte();
+	uint32_t getBits(unsigned count);
+
+	template <size_t symbolCount> bool buildTree(Tree<symbolCount>& tree, const uint8_t* lengths, unsigned count);
+	template <size_t symbolCount> int decodeSymbol(const Tree<symbolCount>& tree);
+
+	bool startBlock();
+	bool buildFixedTrees();
+	bool buildDynamicTrees();
+	bool startMatch(unsigned symbol);
+
+	void put(uint8_t c)
+	{
+		window[outPos & windowMask] = c;
+		++outPos;
+	}
+
+	const ObjectBase& object;
+	uint8_t* window;
+	size_t windowMask;
+	size_t inPos = 0;  ///< Offset of next chunk to read from object
+	uint8_t input[32]; ///< Input chunk
+	uint8_t inputPos = 0;
+	uint8_t inputLength = 0;
+	uint32_t bitBuffer = 0;
+	uint8_t bitCount = 0;
+	State state = State::done;
+	bool lastBlock = false;
+	uint16_t storedRemaining = 0;
+	uint16_t matchLength = 0;
+	uint16_t matchDistance = 0;
+	size_t outPos = 0; ///< Total bytes produced
+	LitTree litTree;
+	DistTree distTree;
+};
+
+} // namespace FSTR
@@ -0,0 +1,101 @@
+/**
+ * LengthIndex.hpp - Defines the LengthIndex class and associated macros
+ *
+ * Copyright 2019 mikee47 <mike@sillyhouse.net>
+ *
+ * This file is part of the FlashString Library
+ *
+ * This library is free software: you can redistribute it and/or modify it under the terms of the
+ * GNU General Public License as published by the Free Software Foundation, version 3 or later.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with FlashString.
+ * If not, see <https://www.gnu.org/licenses/>.
+ *
+ ****/
+
+#pragma once
+
+#include "Array.hpp"
+
+/**
+ * @brief Declare a global LengthIndex& reference
+ * @param name
+ * @note Use `DEFINE_FSTR_LENGTH_INDEX` to instantiate the global Object
+ */
+#define DECLARE_FSTR_LENGTH_INDEX(name) extern const FSTR::LengthIndex& name;
+
+/**
+ * @brief Define a LengthIndex Object with global reference
+ * @param name Name of LengthIndex& reference to define
+ * @param ... Index content, as produced by `tools/fsindex.py length`
+ */
+#define DEFINE_FSTR_LENGTH_INDEX(name, ...)                                                                            \
+	static DEFINE_FSTR_ARRAY_DATA(FSTR_DATA_NAME(name), uint16_t, __VA_ARGS__);                                        \
+	DEFINE_FSTR_REF_NAMED(name, FSTR::LengthIndex);
+
+/**
+ * @brief Define a LengthIndex Object with local reference
+ * @param name Name of LengthIndex& reference to define
+ * @param ... Index content, as produced by `tools/fsindex.py length`
+ */
+#define DEFINE_FSTR_LENGTH_INDEX_LOCAL(name, ...)                                                                      \
+	static DEFINE_FSTR_ARRAY_DATA(FSTR_DATA_NAME(name), uint16_t, __VA_ARGS__);                                        \
+	static constexpr DEFINE_FSTR_REF_NAMED(name, FSTR::LengthIndex);
+
+namespace FSTR
+{
+/**
+ * @brief Groups the indices of a list of Strings by length
+ * @note Index is generated at build time from the list of Strings, which must be provided in the
+ * same order as the object being indexed (e.g. a Vector). Content is an array of uint16_t values:
+ *
+ * 		bucketCount, start[bucketCount + 1], index[stringCount]
+ *
+ * Indices of Strings with length `n` are found in `index[start[n]]` to `index[start[n + 1] - 1]`.
+ * The final bucket also contains all longer Strings.
+ */
+class LengthIndex : public Object<LengthIndex, uint16_t>
+{
+public:
+	/**
+	 * @brief Get the range of candidate entries for a String of the given length
+	 * @param stringLength
+	 * @param first On return, position of first candidate
+	 * @param count On return, number of candidates
+	 * @note Candidates are obtained by calling `candidate(first)` to `candidate(first + count - 1)`
+	 */
+	void getRange(size_t stringLength, unsigned& first, unsigned& count) const
+	{
+		auto buckets = bucketCount();
+		if(buckets == 0) {
+			first = count = 0;
+			return;
+		}
+		auto p = data();
+		auto bucket = std::min(stringLength, buckets - 1);
+		first = readValue(&p[1 + bucket]);
+		count = readValue(&p[2 + bucket]) - first;
+	}
+
+	/**
+	 * @brief Get an index value from the table
+	 * @param pos Position obtained via `getRange()`
+	 * @retval unsigned Index of String in the indexed object
+	 */
+	unsigned candidate(unsigned pos) const
+	{
+		return valueAt(2 + bucketCount() + pos);
+	}
+
+private:
+	size_t bucketCount() const
+	{
+		return (length() < 2) ? 0 : valueAt(0);
+	}
+};
+
+} // namespace FSTR
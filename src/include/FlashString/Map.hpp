@@ -23,8 +23,10 @@
 
 #include "Object.hpp"
 #include "MapPair.hpp"
+#include "HashedMapPair.hpp"
 #include "MapPrinter.hpp"
 #include "ObjectIterator.hpp"
+#include "HashIndex.hpp"
 
 /**
  * @brief Declare a global Map& reference
@@ -109,7 +111,54 @@
 	constexpr const struct {                                                                                           \
 		FSTR::ObjectBase object;                                                                                       \
 		FSTR::MapPair<KeyType, ContentType> data[size];                                                                \
-	} FSTR_PACKED name PROGMEM = {{sizeof(name.data)}, {__VA_ARGS__}};                                                 \
+	} FSTR_PACKED name PROGMEM = {                                                                                     \
+		{FSTR::ObjectBase::encodeLength(FSTR::mapType<KeyType>(), sizeof(name.data[0]), sizeof(name.data))},           \
+		{__VA_ARGS__}};                                                                                                \
+	FSTR_CHECK_STRUCT(name);
+
+/**
+ * @brief Declare a global Map& reference with hashed String keys
+ * @param name
+ * @param ContentType Object type to declare for content
+ * @note Use `DEFINE_FSTR_MAP_HASHED` to instantiate the global object
+ */
+#define DECLARE_FSTR_MAP_HASHED(name, ContentType) extern const FSTR::HashedMap<ContentType>& name;
+
+/**
+ * @brief Define a Map Object with hashed String keys and global reference
+ * @name Name of the Map& reference to define
+ * @param ContentType Object type to declare for content
+ * @param ... List of HashedMapPair definitions { &key, &content, FSTR_KEY_HASH(key) }
+ */
+#define DEFINE_FSTR_MAP_HASHED(name, ContentType, ...)                                                                 \
+	static DEFINE_FSTR_MAP_HASHED_DATA(FSTR_DATA_NAME(name), ContentType, __VA_ARGS__);                                \
+	DEFINE_FSTR_REF_NAMED(name, FSTR::HashedMap<ContentType>);
+
+/**
+ * @brief Define a Map Object with hashed String keys and local reference
+ * @name Name of the Map& reference to define
+ * @param ContentType Object type to declare for content
+ * @param ... List of HashedMapPair definitions { &key, &content, FSTR_KEY_HASH(key) }
+ */
+#define DEFINE_FSTR_MAP_HASHED_LOCAL(name, ContentType, ...)                                                           \
+	static DEFINE_FSTR_MAP_HASHED_DATA(FSTR_DATA_NAME(name), ContentType, __VA_ARGS__);                                \
+	static constexpr DEFINE_FSTR_REF_NAMED(name, FSTR::HashedMap<ContentType>);
+
+/**
+ * @brief Define a Map data structure with hashed String keys
+ * @param name Name of data structure
+ * @param ContentType Object type to declare for content
+ * @param ... List of HashedMapPair definitions { &key, &content, FSTR_KEY_HASH(key) }
+ */
+#define DEFINE_FSTR_MAP_HASHED_DATA(name, ContentType, ...)                                                            \
+	constexpr const struct {                                                                                           \
+		FSTR::ObjectBase object;                                                                                       \
+		FSTR::HashedMapPair<ContentType>                                                                               \
+			data[sizeof((const FSTR::HashedMapPair<ContentType>[]){__VA_ARGS__}) /                                     \
+				 sizeof(FSTR::HashedMapPair<ContentType>)];                                                            \
+	} FSTR_PACKED name PROGMEM = {                                                                                     \
+		{FSTR::ObjectBase::encodeLength(FSTR::Type::HashedMap, sizeof(name.data[0]), sizeof(name.data))},              \
+		{__VA_ARGS__}};                                                                                                \
 	FSTR_CHECK_STRUCT(name);
 
 namespace FSTR
@@ -118,23 +167,34 @@ namespace FSTR
  * @brief Class template to access an associative map
  */
 template <typename KeyType, class ContentType, class Pair = MapPair<KeyType, ContentType>>
-class Map : public Object<Map<KeyType, ContentType>, Pair>
+class Map : public Object<Map<KeyType, ContentType, Pair>, Pair>
 {
+	static constexpr bool keysHashed = std::is_same<Pair, HashedMapPair<ContentType>>::value;
+
 public:
+	using View = typename Object<Map<KeyType, ContentType, Pair>, Pair>::View;
+
 	/**
-	 * @brief Get a map entry by index, if it exists
-	 * @note Result validity can be checked using if()
+	 * @brief Read a map entry using a view
 	 */
-	const Pair valueAt(unsigned index) const
+	static const Pair readElement(const View& view, unsigned index)
 	{
-		if(index >= this->length()) {
+		if(index >= view.length()) {
 			return Pair::empty();
 		}
 
 		static_assert(offsetof(Pair, content_) == sizeof(uint32_t), "Misaligned MapPair");
 
-		auto ptr = this->data() + index;
-		return Pair{readValue(&ptr->key_), readValue(&ptr->content_)};
+		return readPair(view.data() + index);
+	}
+
+	/**
+	 * @brief Get a map entry by index, if it exists
+	 * @note Result validity can be checked using if()
+	 */
+	const Pair valueAt(unsigned index) const
+	{
+		return readElement(this->view(), index);
 	}
 
 	/**
@@ -145,8 +205,9 @@ public:
 	template <typename TRefKey, typename T = KeyType>
 	typename std::enable_if<!std::is_class<T>::value, int>::type indexOf(const TRefKey& key) const
 	{
-		auto p = this->data();
-		auto len = this->length();
+		auto v = this->view();
+		auto p = v.data();
+		auto len = v.length();
 		for(unsigned i = 0; i < len; ++i, ++p) {
 			if(p->key() == key) {
 				return i;
@@ -163,11 +224,12 @@ public:
 	 * @retval int If key isn't found, return -1
 	 */
 	template <typename TRefKey, typename T = KeyType>
-	typename std::enable_if<std::is_same<T, String>::value, int>::type indexOf(const TRefKey& key,
-																			   bool ignoreCase = true) const
+	typename std::enable_if<std::is_same<T, String>::value && !keysHashed, int>::type
+	indexOf(const TRefKey& key, bool ignoreCase = true) const
 	{
-		auto p = this->data();
-		auto len = this->length();
+		auto v = this->view();
+		auto p = v.data();
+		auto len = v.length();
 		for(unsigned i = 0; i < len; ++i, ++p) {
 			if(ignoreCase) {
 				if(p->key().equalsIgnoreCase(key)) {
@@ -181,6 +243,94 @@ public:
 		return -1;
 	}
 
+	/**
+	 * @brief Lookup a String key using stored key hashes
+	 * @param key
+	 * @param keyLength
+	 * @param ignoreCase Whether search is case-sensitive (default: true)
+	 * @retval int If key isn't found, return -1
+	 * @note Keys are only compared where the hash matches
+	 */
+	template <typename T = KeyType>
+	typename std::enable_if<std::is_same<T, String>::value && keysHashed, int>::type
+	indexOf(const char* key, size_t keyLength, bool ignoreCase = true) const
+	{
+		if(key == nullptr) {
+			keyLength = 0;
+		}
+		auto hash = Hash::calculate(key, keyLength, true);
+		auto v = this->view();
+		auto p = v.data();
+		auto len = v.length();
+		for(unsigned i = 0; i < len; ++i, ++p) {
+			if(p->keyHash() == hash && p->key().compare(key, keyLength, ignoreCase) == 0) {
+				return i;
+			}
+		}
+
+		return -1;
+	}
+
+	template <typename T = KeyType>
+	typename std::enable_if<std::is_same<T, String>::value && keysHashed, int>::type
+	indexOf(const char* key, bool ignoreCase = true) const
+	{
+		return indexOf(key, (key == nullptr) ? 0 : strlen(key), ignoreCase);
+	}
+
+	template <typename T = KeyType>
+	typename std::enable_if<std::is_same<T, String>::value && keysHashed, int>::type
+	indexOf(const WString& key, bool ignoreCase = true) const
+	{
+		return indexOf(key.c_str(), key.length(), ignoreCase);
+	}
+
+	template <typename T = KeyType>
+	typename std::enable_if<std::is_same<T, String>::value && keysHashed, int>::type
+	indexOf(const String& key, bool ignoreCase = true) const
+	{
+		LOAD_FSTR(buf, key);
+		return indexOf(buf, key.length(), ignoreCase);
+	}
+
+	/**
+	 * @brief Lookup a String key using a perfect hash table
+	 * @param key
+	 * @param keyLength
+	 * @param index Table generated from the keys of this Map
+	 * @retval int If key isn't found, return -1
+	 * @note Case-sensitivity is determined by the table
+	 */
+	template <typename T = KeyType>
+	typename std::enable_if<std::is_same<T, String>::value, int>::type indexOf(const char* key, size_t keyLength,
+																			   const HashIndex& index) const
+	{
+		if(key == nullptr) {
+			keyLength = 0;
+		}
+		int i = index.find(key, keyLength);
+		auto v = this->view();
+		if(i < 0 || unsigned(i) >= v.length()) {
+			return -1;
+		}
+		auto& k = v.data()[i].key();
+		return (k.compare(key, keyLength, index.ignoreCase()) == 0) ? i : -1;
+	}
+
+	template <typename T = KeyType>
+	typename std::enable_if<std::is_same<T, String>::value, int>::type indexOf(const char* key,
+																			   const HashIndex& index) const
+	{
+		return indexOf(key, (key == nullptr) ? 0 : strlen(key), index);
+	}
+
+	template <typename T = KeyType>
+	typename std::enable_if<std::is_same<T, String>::value, int>::type indexOf(const WString& key,
+																			   const HashIndex& index) const
+	{
+		return indexOf(key.c_str(), key.length(), index);
+	}
+
 	/**
 	 * @brief Lookup a key and return the entry, if found
 	 * @param key
@@ -197,15 +347,35 @@ public:
 	 * @brief Returns a printer object for this array
 	 * @note ElementType must be supported by Print
 	 */
-	MapPrinter<Map> printer() const
+	MapPrinter<Map> printer(const PrintFormat& format = defaultMapFormat) const
 	{
-		return MapPrinter<Map>(*this);
+		return MapPrinter<Map>(*this, format);
 	}
 
 	size_t printTo(Print& p) const
 	{
 		return printer().printTo(p);
 	}
+
+private:
+	template <typename P = Pair>
+	static typename std::enable_if<!std::is_same<P, HashedMapPair<ContentType>>::value, P>::type
+	readPair(const P* ptr)
+	{
+		return P{readValue(&ptr->key_), readValue(&ptr->content_)};
+	}
+
+	template <typename P = Pair>
+	static typename std::enable_if<std::is_same<P, HashedMapPair<ContentType>>::value, P>::type
+	readPair(const P* ptr)
+	{
+		return P{ptr->key_, ptr->content_, ptr->hash_};
+	}
 };
 
+/**
+ * @brief A Map with String keys, storing a hash of each key
+ */
+template <class ContentType> using HashedMap = Map<String, ContentType, HashedMapPair<ContentType>>;
+
 } // namespace FSTR
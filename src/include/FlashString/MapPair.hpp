@@ -97,14 +97,14 @@ public:
 
 	/* Print support */
 
-	size_t printTo(Print& p) const
+	size_t printTo(Print& p, const PrintFormat& format = defaultArrayFormat) const
 	{
 		size_t count = 0;
 
 		if(*this) {
-			count += print(p, key());
+			count += print(p, key(), format);
 			count += p.print(" => ");
-			count += print(p, content());
+			count += print(p, content(), format);
 		} else {
 			count += p.print("(invalid)");
 		}
@@ -30,27 +30,39 @@ namespace FSTR
 template <class MapType> class MapPrinter : public Printable
 {
 public:
-	MapPrinter(const MapType& map) : map(map)
+	/**
+	 * @brief Constructor
+	 * @param map
+	 * @param format Number settings also apply to keys and content, which use the default Array layout.
+	 * The separator is printed before each entry.
+	 */
+	MapPrinter(const MapType& map, const PrintFormat& format = defaultMapFormat) : map(map), format(format)
 	{
 	}
 
 	size_t printTo(Print& p) const override
 	{
+		auto entryFormat = defaultArrayFormat;
+		entryFormat.base = format.base;
+		entryFormat.width = format.width;
+		entryFormat.precision = format.precision;
+
 		size_t count = 0;
 
-		count += p.println("{");
-		for(unsigned i = 0; i < map.length(); ++i) {
-			count += p.print("  ");
-			count += map.valueAt(i).printTo(p);
-			count += p.println();
+		count += printText(p, format.prefix);
+		for(auto pair : map) {
+			// Separator introduces each entry, so nothing is printed for an empty Map
+			count += printText(p, format.separator);
+			count += pair.printTo(p, entryFormat);
 		}
-		count += p.print("}");
+		count += printText(p, format.suffix);
 
 		return count;
 	}
 
 private:
 	const MapType& map;
+	PrintFormat format;
 };
 
 } // namespace FSTR
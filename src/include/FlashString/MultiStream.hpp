@@ -0,0 +1,122 @@
+/**
+ * MultiStream.hpp - Defines the MultiStream class
+ *
+ * Copyright 2019 mikee47 <mike@sillyhouse.net>
+ *
+ * This file is part of the FlashString Library
+ *
+ * This library is free software: you can redistribute it and/or modify it under the terms of the
+ * GNU General Public License as published by the Free Software Foundation, version 3 or later.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with FlashString.
+ * If not, see <https://www.gnu.org/licenses/>.
+ *
+ ****/
+
+#pragma once
+
+#include "String.hpp"
+#include <WString.h>
+#include "Vector.hpp"
+#include "Map.hpp"
+#include <Data/Stream/DataSourceStream.h>
+
+namespace FSTR
+{
+/** @addtogroup stream
+ *  @{
+ */
+
+/*
+ * Provides a read-only stream of the contents of a list of Strings, one after the other
+ */
+class MultiStream : public IDataSourceStream
+{
+public:
+	/**
+	 * @brief Function to obtain a String from the list
+	 * @param list The Vector or Map
+	 * @param index Position in list
+	 */
+	using GetString = const String& (*)(const ObjectBase& list, unsigned index);
+
+	/**
+	 * @brief Construct a stream containing all Strings in a Vector
+	 * @param vector
+	 * @param flashread Specify true to read using flashmem functions, otherwise data is accessed via cache
+	 */
+	MultiStream(const Vector<String>& vector, bool flashread = true)
+		: MultiStream(vector, vector.length(), getVectorString, flashread)
+	{
+	}
+
+	/**
+	 * @brief Construct a stream containing the content of all entries in a Map
+	 * @param map
+	 * @param flashread Specify true to read using flashmem functions, otherwise data is accessed via cache
+	 */
+	template <typename KeyType, class Pair>
+	MultiStream(const Map<KeyType, String, Pair>& map, bool flashread = true)
+		: MultiStream(map, map.length(), getMapString<KeyType, Pair>, flashread)
+	{
+	}
+
+	/**
+	 * @brief Construct a stream using a custom list
+	 * @param list
+	 * @param listLength Number of Strings in the list
+	 * @param getString Function to obtain each String
+	 * @param flashread Specify true to read using flashmem functions, otherwise data is accessed via cache
+	 */
+	MultiStream(const ObjectBase& list, unsigned listLength, GetString getString, bool flashread = true);
+
+	StreamType getStreamType() const override
+	{
+		return eSST_Memory;
+	}
+
+	int available() override
+	{
+		return length - readPos;
+	}
+
+	/**
+	 * @brief Read data, which may span several Strings
+	 */
+	uint16_t readMemoryBlock(char* data, int bufSize) override;
+
+	int seekFrom(int offset, unsigned origin) override;
+
+	bool isFinished() override
+	{
+		return readPos >= length;
+	}
+
+private:
+	static const String& getVectorString(const ObjectBase& list, unsigned index)
+	{
+		return list.as<Vector<String>>()[index];
+	}
+
+	template <typename KeyType, class Pair> static const String& getMapString(const ObjectBase& list, unsigned index)
+	{
+		return list.as<Map<KeyType, String, Pair>>().valueAt(index).content();
+	}
+
+	const ObjectBase& list;
+	GetString getString;
+	unsigned listLength;
+	bool flashread;
+	size_t length = 0;		 ///< Total length of all Strings
+	size_t readPos = 0;		 ///< Current read position
+	unsigned segment = 0;	 ///< Index of String containing readPos, or listLength if at end
+	size_t segmentStart = 0; ///< Stream position of start of current String
+};
+
+/** @} */
+
+} // namespace FSTR
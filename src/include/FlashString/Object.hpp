@@ -23,6 +23,7 @@
 
 #include "Utility.hpp"
 #include "ObjectBase.hpp"
+#include "ResolvedView.hpp"
 #include "ObjectIterator.hpp"
 
 /**
@@ -70,7 +71,8 @@
  */
 #define FSTR_CHECK_STRUCT(name)                                                                                        \
 	static_assert(std::is_pod<decltype(name)>::value, "FSTR structure not POD");                                       \
-	static_assert(offsetof(decltype(name), data) == sizeof(uint32_t), "FSTR structure alignment error");
+	static_assert(offsetof(decltype(name), data) == sizeof(uint32_t), "FSTR structure alignment error");               \
+	static_assert(sizeof(name.data) <= FSTR::ObjectBase::maxLength, "FSTR structure too large");
 
 namespace FSTR
 {
@@ -84,6 +86,7 @@ template <class ObjectType, typename ElementType> class Object : public ObjectBa
 {
 public:
 	using Iterator = ObjectIterator<ObjectType, ElementType>;
+	using View = ResolvedView<ElementType>;
 
 	/**
 	 * @brief Creates a null object
@@ -129,11 +132,32 @@ public:
 		return ObjectBase::length() / sizeof(ElementType);
 	}
 
+	/**
+	 * @brief Get a view of the object data, for efficient access to multiple elements
+	 */
+	FSTR_INLINE View view() const
+	{
+		size_t len;
+		auto ptr = ObjectBase::resolve(len);
+		return View(reinterpret_cast<const ElementType*>(ptr), len / sizeof(ElementType));
+	}
+
+	/**
+	 * @brief Read an element using a view
+	 * @note Used by iterators. Object types which return elements differently
+	 * (e.g. Vector, Map) provide their own version.
+	 */
+	static FSTR_INLINE ElementType readElement(const View& view, unsigned index)
+	{
+		return view.valueAt(index);
+	}
+
 	template <typename ValueType> int indexOf(const ValueType& value) const
 	{
-		auto len = length();
+		auto v = view();
+		auto len = v.length();
 		for(unsigned i = 0; i < len; ++i) {
-			if(as<ObjectType>().valueAt(i) == value) {
+			if(ObjectType::readElement(v, i) == value) {
 				return i;
 			}
 		}
@@ -143,11 +167,7 @@ public:
 
 	FSTR_INLINE ElementType valueAt(unsigned index) const
 	{
-		if(index < length()) {
-			return readValue(data() + index);
-		} else {
-			return ElementType{0};
-		}
+		return view().valueAt(index);
 	}
 
 	/**
@@ -22,6 +22,8 @@
 #pragma once
 
 #include "config.hpp"
+#include "ContentHash.hpp"
+#include "Type.hpp"
 
 namespace FSTR
 {
@@ -62,6 +64,14 @@ public:
 	 */
 	const uint8_t* data() const;
 
+	/**
+	 * @brief Get a pointer to the flash data and its length in a single operation
+	 * @param length On return, length of the object data in bytes
+	 * @retval const uint8_t* As for `data()`
+	 * @note A copy is resolved only once, instead of once each for `data()` and `length()`
+	 */
+	const uint8_t* resolve(size_t& length) const;
+
 	/**
 	 * @brief Read contents of a String into RAM
 	 * @param offset Zero-based offset from start of flash data to start reading
@@ -96,11 +106,69 @@ public:
 	 */
 	size_t readFlash(size_t offset, void* buffer, size_t count) const;
 
+	/**
+	 * @brief Get hashes of the object content calculated at build time
+	 * @retval ContentHash If the object was not imported using `IMPORT_FSTR_HASHED`, is a slice,
+	 * or the hash file was generated from content of a different length, no hashes are present
+	 * and `ContentHash::flags` is 0
+	 * @note The content itself is not accessed
+	 */
+	ContentHash contentHash() const;
+
+	/**
+	 * @brief Get the type of object, as recorded when it was defined
+	 * @retval Type For copies and slices, the type of the real object. Unknown for null objects.
+	 * @note Allows generic code to walk a graph of objects without knowing their C++ types
+	 */
+	Type type() const;
+
+	/**
+	 * @brief Get the size of each element, as recorded when the object was defined
+	 * @retval size_t 0 if not recorded. Only sizes of 1, 2, 4, 8, 12, 16 and 24 bytes are recorded.
+	 * @note As for `Object::elementSize()`, but available without knowing the object type.
+	 * For Maps this is the size of each pair, with the content pointer at the halfway point.
+	 */
+	size_t elementSize() const;
+
+	/**
+	 * @brief Get the value stored in the object header
+	 * @param type Type of object
+	 * @param elementSize Size of each element in bytes
+	 * @param length Length of object data in bytes, must not exceed `maxLength`
+	 * @note Used when defining objects
+	 */
+	static constexpr uint32_t encodeLength(Type type, size_t elementSize, size_t length)
+	{
+		return (uint32_t(type) << typeShift) | (encodeElementSize(elementSize) << elementSizeShift) | length;
+	}
+
+	/**
+	 * @brief Get the object length from the value stored in the header of a real flash object
+	 */
+	static constexpr size_t decodeLength(uint32_t flashLength)
+	{
+		return flashLength & maxLength;
+	}
+
+	static constexpr uint32_t maxLength = 0x003fffffU; ///< Largest object which can be stored
+
+	/**
+	 * @brief Determine if this object refers to data held elsewhere
+	 * @note This includes slices
+	 */
 	FSTR_INLINE bool isCopy() const
 	{
 		return (flashLength_ & copyBit) != 0;
 	}
 
+	/**
+	 * @brief Determine if this object is a `Slice`, describing part of another object
+	 */
+	FSTR_INLINE bool isSlice() const
+	{
+		return flashLength_ == sliceMarker;
+	}
+
 	/**
 	 * @brief Indicates an invalid String, used for return value from lookups, etc.
 	 * @note A real String can be zero-length, but it cannot be null
@@ -125,19 +193,69 @@ protected:
 
 	/*
 	 * @brief Make a 'copy' of this object by taking a reference to the real one
+	 * @note A slice holds its range in RAM, so a copy refers to the slice itself
 	 */
 	void copy(const ObjectBase& obj)
 	{
-		if(obj.isCopy()) {
+		if(obj.isCopy() && !obj.isSlice()) {
 			flashLength_ = obj.flashLength_;
 		} else {
 			flashLength_ = reinterpret_cast<uint32_t>(&obj) | copyBit;
 		}
 	}
 
+	/*
+	 * @brief Range of a real object described by a Slice
+	 * @note Stored by the Slice immediately following flashLength_
+	 */
+	struct SliceData {
+		const ObjectBase* object;
+		uint32_t offset;
+		uint32_t length;
+	};
+
+	/*
+	 * @brief Called by Slice constructor
+	 * @param slice Storage for the range
+	 * @param obj Object to take range from, may itself be a slice or a copy
+	 * @param offset Position of range within obj, in bytes
+	 * @param length Length of range in bytes
+	 * @note Range is clipped to the content of obj
+	 */
+	void initSlice(SliceData& slice, const ObjectBase& obj, size_t offset, size_t length);
+
+	FSTR_INLINE const SliceData& getSlice() const
+	{
+		return *reinterpret_cast<const SliceData*>(this + 1);
+	}
+
+	/*
+	 * @brief Get the object in flash to which this refers
+	 * @retval const ObjectBase* nullptr if this object is null
+	 */
+	const ObjectBase* flashObject() const;
+
 private:
 	static constexpr uint32_t copyBit = 0x80000000U;	   ///< Set to indicate copy
 	static constexpr uint32_t lengthInvalid = copyBit | 0; ///< Indicates null string in a copy
+	static constexpr uint32_t sliceMarker = copyBit | 1;   ///< Copy addresses are word-aligned so cannot clash
+	static constexpr uint32_t hashBit = 0x40000000U;	   ///< Set in flash objects preceded by a ContentHash
+	static constexpr unsigned typeShift = 25;			   ///< Bits 25-29 contain the Type
+	static constexpr unsigned elementSizeShift = 22;	   ///< Bits 22-24 contain encoded elementSize
+
+	static constexpr uint32_t encodeElementSize(size_t size, uint32_t value = 1)
+	{
+		return (value > 7) ? 0 : (size == decodeElementSize(value)) ? value : encodeElementSize(size, value + 1);
+	}
+
+	static constexpr size_t decodeElementSize(uint32_t value)
+	{
+		return (value == 0) ? 0 : (value <= 4) ? (1U << (value - 1)) : (value == 7) ? 24 : (value - 2) * 4;
+	}
 };
 
+static_assert(FSTR_IMPORT_TYPE_STRING == ObjectBase::encodeLength(Type::String, 1, 0), "Bad import type");
+static_assert(FSTR_IMPORT_TYPE_COMPRESSED == ObjectBase::encodeLength(Type::Compressed, 1, 0),
+			  "Bad import type");
+
 }; // namespace FSTR
@@ -21,6 +21,7 @@
 
 #pragma once
 
+#include "ResolvedView.hpp"
 #include <iterator>
 
 namespace FSTR
@@ -32,7 +33,7 @@ public:
 	ObjectIterator() = default;
 	ObjectIterator(const ObjectIterator&) = default;
 
-	ObjectIterator(const ObjectType& object, unsigned index) : object(object), index(index)
+	ObjectIterator(const ObjectType& object, unsigned index) : view(object.view()), index(index)
 	{
 	}
 
@@ -72,7 +73,7 @@ public:
 	template <typename T = ElementType>
 	typename std::enable_if<!std::is_pointer<T>::value, const ElementType>::type operator*() const
 	{
-		return object.valueAt(index);
+		return ObjectType::readElement(view, index);
 	}
 
 	/**
@@ -82,11 +83,11 @@ public:
 	typename std::enable_if<std::is_pointer<T>::value, const typename std::remove_pointer<ElementType>::type&>::type
 	operator*() const
 	{
-		return object.valueAt(index);
+		return ObjectType::readElement(view, index);
 	}
 
 private:
-	const ObjectType& object;
+	ResolvedView<ElementType> view; ///< Object data is resolved once, on construction
 	unsigned index = 0;
 };
 
@@ -1,5 +1,5 @@
 /**
- * Print.cpp - Helper function templates to simplify printing of objects and variables
+ * Print.hpp - Helper function templates to simplify printing of objects and variables
  *
  * Copyright 2019 mikee47 <mike@sillyhouse.net>
  *
@@ -19,10 +19,29 @@
 
 #pragma once
 
+#include "PrintFormat.hpp"
 #include <Print.h>
 
 namespace FSTR
 {
+/**
+ * @brief Print text which may be stored in flash
+ * @param p
+ * @param text nullptr prints nothing
+ * @retval size_t
+ */
+size_t printText(Print& p, const char* text);
+
+/**
+ * @brief Print an integer using the base and width from a format
+ * @param p
+ * @param value
+ * @param format
+ * @retval size_t
+ */
+size_t printNumber(Print& p, uint64_t value, const PrintFormat& format);
+size_t printNumber(Print& p, int64_t value, const PrintFormat& format);
+
 /**
  * @brief Print an object
  * @param p
@@ -46,6 +65,75 @@ template <typename T> typename std::enable_if<!std::is_class<T>::value, size_t>:
 	return p.print(value);
 }
 
+/*
+ * Determine whether an object provides a printer accepting a PrintFormat
+ */
+template <class ObjectType> class HasFormattedPrinter
+{
+	template <class T>
+	static auto test(int) -> decltype(std::declval<const T&>().printer(std::declval<const PrintFormat&>()),
+									  std::true_type());
+	template <class> static std::false_type test(...);
+
+public:
+	static constexpr bool value = decltype(test<ObjectType>(0))::value;
+};
+
+/**
+ * @brief Print an object using a format, if it supports one
+ * @param p
+ * @param object
+ * @param format
+ * @retval size_t
+ */
+template <class ObjectType>
+typename std::enable_if<HasFormattedPrinter<ObjectType>::value, size_t>::type
+print(Print& p, const ObjectType& object, const PrintFormat& format)
+{
+	return object.printer(format).printTo(p);
+}
+
+template <class ObjectType>
+typename std::enable_if<std::is_class<ObjectType>::value && !HasFormattedPrinter<ObjectType>::value, size_t>::type
+print(Print& p, const ObjectType& object, const PrintFormat&)
+{
+	return object.printTo(p);
+}
+
+/**
+ * @brief Print an integer using a format
+ * @note char values are printed as characters
+ */
+template <typename T>
+typename std::enable_if<std::is_integral<T>::value && !std::is_same<T, char>::value, size_t>::type
+print(Print& p, T value, const PrintFormat& format)
+{
+	using Value = typename std::conditional<std::is_signed<T>::value, int64_t, uint64_t>::type;
+	return printNumber(p, Value(value), format);
+}
+
+/**
+ * @brief Print a floating-point value using a format
+ */
+template <typename T>
+typename std::enable_if<std::is_floating_point<T>::value, size_t>::type print(Print& p, T value,
+																			   const PrintFormat& format)
+{
+	return p.print(value, format.precision);
+}
+
+/**
+ * @brief Print other elementary values, such as char or enum, ignoring the format
+ */
+template <typename T>
+typename std::enable_if<!std::is_class<T>::value && !std::is_floating_point<T>::value &&
+							(!std::is_integral<T>::value || std::is_same<T, char>::value),
+						size_t>::type
+print(Print& p, T value, const PrintFormat&)
+{
+	return print(p, value);
+}
+
 /**
  * @brief Print an object or elementary variable appending a carriage return
  * @param p
@@ -0,0 +1,58 @@
+/**
+ * PrintFormat.hpp - Defines the PrintFormat structure
+ *
+ * Copyright 2019 mikee47 <mike@sillyhouse.net>
+ *
+ * This file is part of the FlashString Library
+ *
+ * This library is free software: you can redistribute it and/or modify it under the terms of the
+ * GNU General Public License as published by the Free Software Foundation, version 3 or later.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with FlashString.
+ * If not, see <https://www.gnu.org/licenses/>.
+ *
+ ****/
+
+#pragma once
+
+#include "config.hpp"
+
+namespace FSTR
+{
+/**
+ * @brief Describes how printers output the contents of an Array, Vector or Map
+ * @note Text pointers may refer to RAM or flash (e.g. PSTR()) as they're read using aligned accesses.
+ * The separator is printed between Array and Vector elements, but before each Map entry.
+ * Any may be nullptr. Printers keep a copy of the format, so no heap allocation is required.
+ *
+ * Example:
+ *
+ *		constexpr FSTR::PrintFormat hexFormat{16, 8, 0, " ", "", ""};
+ *		Serial.println(myTable.printer(hexFormat));
+ *
+ */
+struct PrintFormat {
+	uint8_t base;		   ///< Number base for integers: 2, 8, 10 or 16
+	uint8_t width;		   ///< Minimum number of digits for integers, padded with leading zeroes
+	uint8_t precision;	   ///< Number of decimal places for floating-point values
+	const char* separator; ///< Printed between elements
+	const char* prefix;	   ///< Opening bracket
+	const char* suffix;	   ///< Closing bracket
+};
+
+/**
+ * @brief Default format for Arrays and Vectors
+ */
+constexpr PrintFormat defaultArrayFormat{10, 0, 2, ", ", "[", "]"};
+
+/**
+ * @brief Default format for Maps, one entry per line
+ * @note For Maps the separator is printed before every entry, so an empty Map prints as "{\r\n}"
+ */
+constexpr PrintFormat defaultMapFormat{10, 0, 2, "\r\n  ", "{", "\r\n}"};
+
+} // namespace FSTR
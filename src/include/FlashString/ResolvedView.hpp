@@ -0,0 +1,77 @@
+/**
+ * ResolvedView.hpp - Defines the ResolvedView class template
+ *
+ * Copyright 2019 mikee47 <mike@sillyhouse.net>
+ *
+ * This file is part of the FlashString Library
+ *
+ * This library is free software: you can redistribute it and/or modify it under the terms of the
+ * GNU General Public License as published by the Free Software Foundation, version 3 or later.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with FlashString.
+ * If not, see <https://www.gnu.org/licenses/>.
+ *
+ ****/
+
+#pragma once
+
+#include "Utility.hpp"
+
+namespace FSTR
+{
+/**
+ * @brief Pointer to object data and its length, resolved once
+ * @note Obtained via `Object::view()`. Objects may be copies, so every call to `Object::length()`
+ * or `Object::data()` has to check for this and follow the pointer to the real object.
+ * Loops accessing many elements should use a view instead.
+ *
+ * A view is only valid for as long as the object it was obtained from.
+ */
+template <typename ElementType> class ResolvedView
+{
+public:
+	constexpr ResolvedView() = default;
+
+	constexpr ResolvedView(const ElementType* data, size_t length) : data_(data), length_(length)
+	{
+	}
+
+	/**
+	 * @brief Get the number of elements
+	 */
+	FSTR_INLINE size_t length() const
+	{
+		return length_;
+	}
+
+	/**
+	 * @brief Get a pointer to the flash data
+	 */
+	FSTR_INLINE const ElementType* data() const
+	{
+		return data_;
+	}
+
+	/**
+	 * @brief Read an element value, with bounds checking
+	 * @retval ElementType Element value, or a zero-initialised value if index is out of range
+	 */
+	FSTR_INLINE ElementType valueAt(unsigned index) const
+	{
+		if(index < length_) {
+			return readValue(data_ + index);
+		} else {
+			return ElementType{};
+		}
+	}
+
+private:
+	const ElementType* data_ = nullptr;
+	size_t length_ = 0;
+};
+
+} // namespace FSTR
@@ -0,0 +1,84 @@
+/**
+ * Slice.hpp - Defines the Slice class template
+ *
+ * Copyright 2019 mikee47 <mike@sillyhouse.net>
+ *
+ * This file is part of the FlashString Library
+ *
+ * This library is free software: you can redistribute it and/or modify it under the terms of the
+ * GNU General Public License as published by the Free Software Foundation, version 3 or later.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with FlashString.
+ * If not, see <https://www.gnu.org/licenses/>.
+ *
+ ****/
+
+#pragma once
+
+#include "ObjectBase.hpp"
+
+namespace FSTR
+{
+/**
+ * @brief Describes part of an object without copying any data
+ * @tparam ObjectType Type of object being sliced, e.g. String or Array<int>
+ * @note Obtained using `String::substring()` or `Array::slice()`.
+ *
+ * A slice is used like any other object of the same type, but it lives in RAM and refers to
+ * the flash data of the original object. Objects copied from a slice refer to the slice itself,
+ * so must not outlive it.
+ *
+ * Slice data is not necessarily word-aligned. Use `read()`, `readFlash()` or `memcpy_P()` to access it.
+ */
+template <class ObjectType> class Slice : public ObjectType
+{
+public:
+	/**
+	 * @brief Constructor
+	 * @param object The object to take a range from
+	 * @param offset Start of range, in bytes
+	 * @param length Length of range in bytes
+	 * @note The range is clipped to the object content. A slice of a null object is also null.
+	 */
+	Slice(const ObjectBase& object, size_t offset, size_t length)
+	{
+		this->initSlice(sliceData, object, offset, length);
+		assert(&this->getSlice() == &sliceData);
+	}
+
+	Slice(const Slice& other) : ObjectType()
+	{
+		this->initSlice(sliceData, other, 0, other.ObjectBase::length());
+	}
+
+	Slice& operator=(const Slice& other)
+	{
+		this->initSlice(sliceData, other, 0, other.ObjectBase::length());
+		return *this;
+	}
+
+	/**
+	 * @brief Get the real object this slice refers to
+	 */
+	const ObjectBase& sourceObject() const
+	{
+		return *sliceData.object;
+	}
+
+	/**
+	 * @brief Get the position of the slice within the real object, in bytes
+	 */
+	size_t sourceOffset() const
+	{
+		return sliceData.offset;
+	}
+
+private:
+	ObjectBase::SliceData sliceData;
+};
+
+} // namespace FSTR
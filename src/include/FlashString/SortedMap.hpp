@@ -0,0 +1,259 @@
+/**
+ * SortedMap.hpp - Defines the SortedMap class template and associated macros
+ *
+ * Copyright 2019 mikee47 <mike@sillyhouse.net>
+ *
+ * This file is part of the FlashString Library
+ *
+ * This library is free software: you can redistribute it and/or modify it under the terms of the
+ * GNU General Public License as published by the Free Software Foundation, version 3 or later.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with FlashString.
+ * If not, see <https://www.gnu.org/licenses/>.
+ *
+ ****/
+
+#pragma once
+
+#include "Map.hpp"
+
+/**
+ * @brief Declare a global SortedMap& reference
+ * @param name
+ * @param KeyType Integral type to use for key
+ * @param ContentType Object type to declare for content
+ * @note Use `DEFINE_FSTR_MAP_SORTED` to instantiate the global object
+ */
+#define DECLARE_FSTR_MAP_SORTED(name, KeyType, ContentType) extern const FSTR::SortedMap<KeyType, ContentType>& name;
+
+/**
+ * @brief Define a SortedMap Object with global reference
+ * @name Name of the SortedMap& reference to define
+ * @param KeyType Integral type to use for key
+ * @param ContentType Object type to declare for content
+ * @param ... List of MapPair definitions { key, &content }, in ascending key order
+ * @note Size will be calculated
+ */
+#define DEFINE_FSTR_MAP_SORTED(name, KeyType, ContentType, ...)                                                        \
+	static DEFINE_FSTR_MAP_SORTED_DATA(FSTR_DATA_NAME(name), KeyType, ContentType, __VA_ARGS__);                       \
+	DEFINE_FSTR_REF_NAMED(name, DECL((FSTR::SortedMap<KeyType, ContentType>)));
+
+/**
+ * @brief Define a SortedMap Object with local reference
+ * @name Name of the SortedMap& reference to define
+ * @param KeyType Integral type to use for key
+ * @param ContentType Object type to declare for content
+ * @param ... List of MapPair definitions { key, &content }, in ascending key order
+ * @note Size will be calculated
+ */
+#define DEFINE_FSTR_MAP_SORTED_LOCAL(name, KeyType, ContentType, ...)                                                  \
+	static DEFINE_FSTR_MAP_SORTED_DATA(FSTR_DATA_NAME(name), KeyType, ContentType, __VA_ARGS__);                       \
+	static constexpr DEFINE_FSTR_REF_NAMED(name, DECL((FSTR::SortedMap<KeyType, ContentType>)));
+
+/**
+ * @brief Define a SortedMap data structure
+ * @param name Name of data structure
+ * @param KeyType Integral type to use for key
+ * @param ContentType Object type to declare for content
+ * @param ... List of MapPair definitions { key, &content }, in ascending key order
+ * @note Integral keys are checked at compile time, String keys cannot be.
+ */
+#define DEFINE_FSTR_MAP_SORTED_DATA(name, KeyType, ContentType, ...)                                                   \
+	DEFINE_FSTR_MAP_DATA(name, KeyType, ContentType, __VA_ARGS__)                                                      \
+	static_assert(FSTR::isSorted(name, 0, sizeof(name.data) / sizeof(name.data[0])), "FSTR Map keys not sorted");
+
+namespace FSTR
+{
+/**
+ * @brief Check map data entries are in strictly ascending key order
+ * @param map The map data structure
+ * @param first Index of first entry to check
+ * @param count Number of entries to check
+ * @retval bool
+ * @note Recursion is split in halves to keep evaluation depth at log2(count),
+ * so large maps don't exceed the compiler's constexpr depth limit.
+ * String keys can't be compared at compile time: use `SortedMap::isSorted()` to verify at runtime.
+ */
+template <typename MapData>
+constexpr typename std::enable_if<!std::is_pointer<decltype(MapData::data[0].key_)>::value, bool>::type
+isSorted(const MapData& map, size_t first, size_t count)
+{
+	return (count < 2) || ((count == 2) ? (map.data[first].key_ < map.data[first + 1].key_)
+										: (isSorted(map, first, count / 2 + 1) &&
+										   isSorted(map, first + count / 2, count - count / 2)));
+}
+
+template <typename MapData>
+constexpr typename std::enable_if<std::is_pointer<decltype(MapData::data[0].key_)>::value, bool>::type
+isSorted(const MapData&, size_t, size_t)
+{
+	return true;
+}
+
+/**
+ * @brief Class template to access an associative map with entries sorted by key
+ * @note Lookups use a binary search.
+ * String keys must be sorted ignoring case, as for `strcasecmp()`, and be unique ignoring case.
+ */
+template <typename KeyType, class ContentType, class Pair = MapPair<KeyType, ContentType>>
+class SortedMap : public Map<KeyType, ContentType, Pair>
+{
+public:
+	/**
+	 * @brief Lookup an integral key and return the index
+	 * @param key Key to locate, must be compatible with KeyType for ordering comparison
+	 * @retval int If key isn't found, return -1
+	 */
+	template <typename TRefKey, typename T = KeyType>
+	typename std::enable_if<!std::is_class<T>::value, int>::type indexOf(const TRefKey& key) const
+	{
+		auto v = this->view();
+		auto p = v.data();
+		int lo = 0;
+		int hi = int(v.length()) - 1;
+		while(lo <= hi) {
+			int mid = (lo + hi) / 2;
+			auto k = p[mid].key();
+			if(k < key) {
+				lo = mid + 1;
+			} else if(key < k) {
+				hi = mid - 1;
+			} else {
+				return mid;
+			}
+		}
+
+		return -1;
+	}
+
+	/**
+	 * @brief Lookup a String key and return the index
+	 * @param key
+	 * @param keyLength
+	 * @param ignoreCase Whether search is case-sensitive (default: true)
+	 * @retval int If key isn't found, return -1
+	 */
+	template <typename T = KeyType>
+	typename std::enable_if<std::is_same<T, String>::value, int>::type indexOf(const char* key, size_t keyLength,
+																			   bool ignoreCase = true) const
+	{
+		if(key == nullptr) {
+			keyLength = 0;
+		}
+		auto v = this->view();
+		auto p = v.data();
+		int lo = 0;
+		int hi = int(v.length()) - 1;
+		while(lo <= hi) {
+			int mid = (lo + hi) / 2;
+			int res = p[mid].key().compare(key, keyLength, true);
+			if(res < 0) {
+				lo = mid + 1;
+			} else if(res > 0) {
+				hi = mid - 1;
+			} else if(ignoreCase || p[mid].key().equals(key, keyLength)) {
+				return mid;
+			} else {
+				break;
+			}
+		}
+
+		return -1;
+	}
+
+	template <typename T = KeyType>
+	typename std::enable_if<std::is_same<T, String>::value, int>::type indexOf(const char* key,
+																			   bool ignoreCase = true) const
+	{
+		return indexOf(key, (key == nullptr) ? 0 : strlen(key), ignoreCase);
+	}
+
+	template <typename T = KeyType>
+	typename std::enable_if<std::is_same<T, String>::value, int>::type indexOf(const WString& key,
+																			   bool ignoreCase = true) const
+	{
+		return indexOf(key.c_str(), key.length(), ignoreCase);
+	}
+
+	template <typename T = KeyType>
+	typename std::enable_if<std::is_same<T, String>::value, int>::type indexOf(const String& key,
+																			   bool ignoreCase = true) const
+	{
+		LOAD_FSTR(buf, key);
+		return indexOf(buf, key.length(), ignoreCase);
+	}
+
+	/**
+	 * @brief Lookup a String key using a perfect hash table
+	 * @see See `Map::indexOf()`
+	 */
+	template <typename T = KeyType>
+	typename std::enable_if<std::is_same<T, String>::value, int>::type indexOf(const char* key, size_t keyLength,
+																			   const HashIndex& index) const
+	{
+		return Map<KeyType, ContentType, Pair>::indexOf(key, keyLength, index);
+	}
+
+	template <typename T = KeyType>
+	typename std::enable_if<std::is_same<T, String>::value, int>::type indexOf(const char* key,
+																			   const HashIndex& index) const
+	{
+		return Map<KeyType, ContentType, Pair>::indexOf(key, index);
+	}
+
+	template <typename T = KeyType>
+	typename std::enable_if<std::is_same<T, String>::value, int>::type indexOf(const WString& key,
+																			   const HashIndex& index) const
+	{
+		return Map<KeyType, ContentType, Pair>::indexOf(key, index);
+	}
+
+	/**
+	 * @brief Lookup a key and return the entry, if found
+	 * @param key
+	 * @note Result validity can be checked using if()
+	 */
+	template <typename TRefKey> const Pair operator[](const TRefKey& key) const
+	{
+		return this->valueAt(indexOf(key));
+	}
+
+	/**
+	 * @brief Verify entries are in the required order
+	 * @retval bool
+	 * @note Integral keys are checked at compile time, so this is mainly useful for String keys
+	 */
+	bool isSorted() const
+	{
+		auto v = this->view();
+		auto p = v.data();
+		auto len = v.length();
+		for(unsigned i = 1; i < len; ++i) {
+			if(!lessThan(p[i - 1], p[i])) {
+				return false;
+			}
+		}
+		return true;
+	}
+
+private:
+	template <typename T = KeyType>
+	static typename std::enable_if<!std::is_class<T>::value, bool>::type lessThan(const Pair& p1, const Pair& p2)
+	{
+		return p1.key() < p2.key();
+	}
+
+	template <typename T = KeyType>
+	static typename std::enable_if<std::is_same<T, String>::value, bool>::type lessThan(const Pair& p1,
+																						 const Pair& p2)
+	{
+		LOAD_FSTR(buf, p2.key());
+		return p1.key().compare(buf, p2.key().length(), true) < 0;
+	}
+};
+
+} // namespace FSTR
@@ -22,7 +22,9 @@
 #pragma once
 
 #include "String.hpp"
+#include "CompressedObject.hpp"
 #include <Data/Stream/DataSourceStream.h>
+#include <memory>
 
 namespace FSTR
 {
@@ -36,15 +38,63 @@ namespace FSTR
 class Stream : public IDataSourceStream
 {
 public:
+	using Encoding = CompressedObject::Encoding;
+
 	/**
 	 * @brief Constructor
 	 * @param string
 	 * @param flashread Specify true to read using flashmem functions, otherwise data is accessed via cache
 	 */
-	Stream(const String& string, bool flashread = true) : string(string), flashread(flashread)
+	Stream(const String& string, bool flashread = true)
+		: object(string), length(string.length()), flashread(flashread)
+	{
+	}
+
+	/**
+	 * @brief Construct a stream containing part of a String
+	 * @param slice
+	 * @param flashread Specify true to read using flashmem functions, otherwise data is accessed via cache
+	 * @note The stream refers directly to the original String, so the slice may be a temporary. Example:
+	 *
+	 * 		auto stream = new FSTR::Stream(content.substring(rangeStart, rangeLength));
+	 */
+	Stream(const Slice<String>& slice, bool flashread = true)
+		: object(slice.sourceObject()), start(slice.sourceOffset()), length(slice.length()), flashread(flashread)
+	{
+	}
+
+	/**
+	 * @brief Construct a stream containing the compressed content of an object, without decompressing it
+	 * @param object
+	 * @param flashread Specify true to read using flashmem functions, otherwise data is accessed via cache
+	 * @note The stream contains a complete gzip stream, suitable for sending to a client which
+	 * accepts it, e.g. with `Content-Encoding: gzip`. Use `getEncoding()` to check.
+	 * Use a `DecompressStream` for clients which do not.
+	 * If the object is invalid the stream is empty and the encoding is `none`.
+	 */
+	Stream(const CompressedObject& object, bool flashread = true);
+
+	/**
+	 * @brief Get the encoding of the stream content
+	 * @retval Encoding `Encoding::none` unless the stream was created from a compressed object
+	 */
+	Encoding getEncoding() const
 	{
+		return encoding;
 	}
 
+	/**
+	 * @brief Enable read-ahead buffering
+	 * @param blockSize Size of RAM buffer, 0 to disable
+	 * @retval bool false if the buffer could not be allocated
+	 * @note Only applies in `flashread` mode. Each flash read fetches a whole block, starting at a
+	 * word-aligned position, and smaller reads are then served from RAM. Consumers typically request
+	 * the same data more than once (via `readMemoryBlock()`) before calling `seek()`, so this can
+	 * considerably reduce the number of flash accesses when serving large content.
+	 * Reads larger than the block size bypass the buffer.
+	 */
+	bool setReadAhead(size_t blockSize);
+
 	StreamType getStreamType() const override
 	{
 		return eSST_Memory;
@@ -56,7 +106,7 @@ public:
 	*/
 	int available() override
 	{
-		return string.length() - readPos;
+		return length - readPos;
 	}
 
 	uint16_t readMemoryBlock(char* data, int bufSize) override;
@@ -65,13 +115,46 @@ public:
 
 	bool isFinished() override
 	{
-		return readPos >= string.length();
+		return readPos >= length;
+	}
+
+	/**
+	 * @brief Get a direct pointer to the data at the current read position
+	 * @param length On return, number of bytes available from the pointer
+	 * @retval const char* nullptr if direct access isn't available, or there is no more data
+	 * @note Only available when not using `flashread` mode, as the data is then accessed via the cache.
+	 *
+	 * This allows content to be passed on (e.g. to a TCP connection) without copying it into RAM first.
+	 * The pointer refers to memory-mapped flash, so it must only be accessed using aligned 32-bit reads,
+	 * or by routines which do so such as `memcpy_P()`. For a stream created from a slice the pointer
+	 * itself may not be word-aligned.
+	 *
+	 * Use `seek()` to advance the read position after consuming the data.
+	 */
+	const char* getBufferPtr(size_t& length) const
+	{
+		if(flashread || readPos >= this->length) {
+			length = 0;
+			return nullptr;
+		}
+
+		length = this->length - readPos;
+		return reinterpret_cast<const char*>(object.data()) + start + readPos;
 	}
 
 private:
-	const String& string;
+	void fillBuffer();
+
+	const ObjectBase& object;
+	size_t start = 0; ///< Offset of stream content within object
+	size_t length;	  ///< Length of stream content
+	Encoding encoding = Encoding::none;
 	size_t readPos = 0;
 	bool flashread;
+	std::unique_ptr<char[]> buffer; ///< Read-ahead block
+	size_t bufferSize = 0;
+	size_t bufferStart = 0;  ///< Content offset of buffer
+	size_t bufferLength = 0; ///< Number of valid bytes in buffer
 };
 
 /** @} */
@@ -22,6 +22,7 @@
 #pragma once
 
 #include "Object.hpp"
+#include "Slice.hpp"
 #include "StringPrinter.hpp"
 
 // Wiring String - this file is included from WString.h so define required types only
@@ -85,7 +86,7 @@ typedef const __FlashStringHelper* flash_string_t;
 	constexpr const struct {                                                                                           \
 		FSTR::ObjectBase object;                                                                                       \
 		char data[ALIGNUP(sizeof(str))];                                                                               \
-	} name PROGMEM = {{sizeof(str) - 1}, str};                                                                         \
+	} name PROGMEM = {{FSTR::ObjectBase::encodeLength(FSTR::Type::String, 1, sizeof(str) - 1)}, str};                  \
 	FSTR_CHECK_STRUCT(name);
 
 /**
@@ -99,7 +100,7 @@ typedef const __FlashStringHelper* flash_string_t;
  */
 #define LOAD_FSTR(name, fstr)                                                                                          \
 	char name[(fstr).size()] __attribute__((aligned(4)));                                                              \
-	memcpy_aligned(name, (fstr).data(), (fstr).length());                                                              \
+	(fstr).read(0, name, (fstr).length());                                                                             \
 	name[(fstr).length()] = '\0';
 
 /**
@@ -118,7 +119,18 @@ typedef const __FlashStringHelper* flash_string_t;
  * @param file Absolute path to the file containing the content
  */
 #define IMPORT_FSTR(name, file)                                                                                        \
-	IMPORT_FSTR_DATA(name, file)                                                                                       \
+	IMPORT_FSTR_DATA_TYPED(name, file, FSTR_IMPORT_TYPE_STRING)                                                        \
+	extern "C" const FSTR::String name;
+
+/**
+ * @brief Define a String containing data from an external file, with hashes calculated at build time
+ * @param name Name for the String object
+ * @param file Absolute path to the file containing the content
+ * @note The hash file `file.hash` must be created using `tools/fshash.py`
+ * @see See `ObjectBase::contentHash()`
+ */
+#define IMPORT_FSTR_HASHED(name, file)                                                                                 \
+	IMPORT_FSTR_DATA_WITH_HASH_TYPED(name, file, file ".hash", FSTR_IMPORT_TYPE_STRING)                                \
 	extern "C" const FSTR::String name;
 
 /**
@@ -172,21 +184,166 @@ public:
 		return reinterpret_cast<flash_string_t>(Object::data());
 	}
 
+	/**
+	 * @brief Get part of the String without copying it
+	 * @param offset Position of first character
+	 * @param len Number of characters, default is to end of String
+	 * @retval Slice<String> Refers to the content of this String, which must remain valid
+	 * @note Unlike the Wiring `String::substring()`, the second parameter is a length.
+	 * Out-of-range values are clipped. Example:
+	 *
+	 * 		DEFINE_FSTR(header, "Content-Type: text/plain")
+	 * 		Serial.println(header.substring(14));
+	 */
+	Slice<String> substring(size_t offset, size_t len = SIZE_MAX) const;
+
 	/**
 	 * @brief Check for equality with a C-string
 	 * @param cstr
 	 * @param len Length of cstr (optional)
 	 * @retval bool true if strings are identical
-	 * @note loads string into a stack buffer for the comparison, no heap required
+	 * @note Flash content is compared a word at a time, no copy or heap required
 	 */
 	bool equals(const char* cstr, size_t len = 0) const;
 
+	/**
+	 * @brief Check for equality with a C-string, ignoring case
+	 * @param cstr
+	 * @param len Length of cstr (optional)
+	 * @retval bool true if strings match, ignoring case of ASCII letters
+	 */
+	bool equalsIgnoreCase(const char* cstr, size_t len = 0) const;
+
 	/** @brief Check for equality with another String
 	 *  @param str
 	 *  @retval bool true if strings are identical
 	 */
 	bool equals(const String& str) const;
 
+	/**
+	 * @brief Compare with a C-string
+	 * @param cstr
+	 * @param len Length of cstr
+	 * @param ignoreCase Whether comparison is case-insensitive (default: false)
+	 * @retval int <0, 0 or >0 as for `memcmp()`. If one string is a prefix of the other,
+	 * the shorter one is ordered first.
+	 * @note Content is read in chunks, no heap required.
+	 * Case-insensitive comparisons fold ASCII letters to lower case, as for `strcasecmp()`.
+	 */
+	int compare(const char* cstr, size_t len, bool ignoreCase = false) const;
+
+	/* Searching */
+
+	using Object::indexOf;
+
+	/**
+	 * @brief Find the first occurrence of a sub-string
+	 * @param needle String to search for
+	 * @param needleLength Length of needle
+	 * @param fromIndex Position to start searching from
+	 * @retval int Position of the match, -1 if not found
+	 * @note Content is read in chunks using `readFlash()`, so the String may be of any size.
+	 * Candidate positions are located by scanning for the first character of the needle.
+	 */
+	int indexOf(const char* needle, size_t needleLength, size_t fromIndex) const;
+
+	int indexOf(const char* needle, size_t fromIndex = 0) const
+	{
+		return indexOf(needle, (needle == nullptr) ? 0 : strlen(needle), fromIndex);
+	}
+
+	int indexOf(const WString& needle, size_t fromIndex = 0) const;
+
+	int indexOf(const String& needle, size_t fromIndex = 0) const
+	{
+		LOAD_FSTR(buf, needle);
+		return indexOf(buf, needle.length(), fromIndex);
+	}
+
+	/**
+	 * @brief Find the last occurrence of a sub-string
+	 * @param needle String to search for
+	 * @param needleLength Length of needle
+	 * @param fromIndex Last position at which a match may start
+	 * @retval int Position of the match, -1 if not found
+	 */
+	int lastIndexOf(const char* needle, size_t needleLength, size_t fromIndex) const;
+
+	int lastIndexOf(const char* needle, size_t fromIndex = SIZE_MAX) const
+	{
+		return lastIndexOf(needle, (needle == nullptr) ? 0 : strlen(needle), fromIndex);
+	}
+
+	int lastIndexOf(const WString& needle, size_t fromIndex = SIZE_MAX) const;
+
+	int lastIndexOf(const String& needle, size_t fromIndex = SIZE_MAX) const
+	{
+		LOAD_FSTR(buf, needle);
+		return lastIndexOf(buf, needle.length(), fromIndex);
+	}
+
+	/**
+	 * @brief Determine if the String contains a sub-string
+	 */
+	template <typename T> bool contains(const T& needle) const
+	{
+		return indexOf(needle) >= 0;
+	}
+
+	bool contains(const char* needle, size_t needleLength) const
+	{
+		return indexOf(needle, needleLength, 0) >= 0;
+	}
+
+	/**
+	 * @brief Determine if the String starts with the given prefix
+	 * @param prefix
+	 * @param prefixLength
+	 * @retval bool
+	 */
+	bool startsWith(const char* prefix, size_t prefixLength) const
+	{
+		return prefixLength <= length() && matchAt(0, prefix, prefixLength);
+	}
+
+	bool startsWith(const char* prefix) const
+	{
+		return startsWith(prefix, (prefix == nullptr) ? 0 : strlen(prefix));
+	}
+
+	bool startsWith(const WString& prefix) const;
+
+	bool startsWith(const String& prefix) const
+	{
+		LOAD_FSTR(buf, prefix);
+		return startsWith(buf, prefix.length());
+	}
+
+	/**
+	 * @brief Determine if the String ends with the given suffix
+	 * @param suffix
+	 * @param suffixLength
+	 * @retval bool
+	 */
+	bool endsWith(const char* suffix, size_t suffixLength) const
+	{
+		auto len = length();
+		return suffixLength <= len && matchAt(len - suffixLength, suffix, suffixLength);
+	}
+
+	bool endsWith(const char* suffix) const
+	{
+		return endsWith(suffix, (suffix == nullptr) ? 0 : strlen(suffix));
+	}
+
+	bool endsWith(const WString& suffix) const;
+
+	bool endsWith(const String& suffix) const
+	{
+		LOAD_FSTR(buf, suffix);
+		return endsWith(buf, suffix.length());
+	}
+
 	bool operator==(const char* str) const
 	{
 		return equals(str);
@@ -234,16 +391,31 @@ public:
 	 *		IMPORT_FSTR(largeString, PROJECT_DIR "/files/large-text.txt");
 	 * 		Serial.println(largeString.printer());
 	 *
+	 * @param chunkSize Size of stack buffer, or `StringPrinter::directWrite`
+	 * @param cacheThreshold Strings no longer than this are read via the cache
 	 */
-	StringPrinter printer() const
+	StringPrinter printer(size_t chunkSize = FSTR_PRINT_CHUNK_SIZE,
+						  size_t cacheThreshold = FSTR_PRINT_CACHE_THRESHOLD) const
 	{
-		return StringPrinter(*this);
+		return StringPrinter(*this, chunkSize, cacheThreshold);
 	}
 
 	size_t printTo(Print& p) const
 	{
 		return printer().printTo(p);
 	}
+
+private:
+	/*
+	 * Compare content starting at offset with a buffer in RAM.
+	 * Caller must ensure offset + length is within the String.
+	 */
+	bool matchAt(size_t offset, const char* str, size_t length) const;
 };
 
+inline Slice<String> String::substring(size_t offset, size_t len) const
+{
+	return Slice<String>(*this, offset, len);
+}
+
 } // namespace FSTR
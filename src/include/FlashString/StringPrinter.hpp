@@ -19,6 +19,7 @@
 
 #pragma once
 
+#include "config.hpp"
 #include <Printable.h>
 
 namespace FSTR
@@ -33,7 +34,22 @@ class String;
 class StringPrinter : public Printable
 {
 public:
-	StringPrinter(const String& string) : string(string)
+	/**
+	 * @brief Use as chunkSize to pass content directly from flash to `Print::write()`
+	 * @note The Print object must then read its input using aligned 32-bit accesses, e.g. via `memcpy_P()`.
+	 * No buffer is used, which is fastest for sinks which can accept it.
+	 */
+	static constexpr size_t directWrite = 0;
+
+	/**
+	 * @brief Constructor
+	 * @param string
+	 * @param chunkSize Size of stack buffer used for output. The buffer is never larger than the String.
+	 * @param cacheThreshold Strings no longer than this are read via the cache, otherwise flash is read directly
+	 */
+	StringPrinter(const String& string, size_t chunkSize = FSTR_PRINT_CHUNK_SIZE,
+				  size_t cacheThreshold = FSTR_PRINT_CACHE_THRESHOLD)
+		: string(string), chunkSize(chunkSize), cacheThreshold(cacheThreshold)
 	{
 	}
 
@@ -41,6 +57,8 @@ public:
 
 private:
 	const String& string;
+	size_t chunkSize;
+	size_t cacheThreshold;
 };
 
 } // namespace FSTR
@@ -0,0 +1,214 @@
+/**
+ * StringTable.hpp - Defines the StringTable class and associated macros
+ *
+ * Copyright 2019 mikee47 <mike@sillyhouse.net>
+ *
+ * This file is part of the FlashString Library
+ *
+ * This library is free software: you can redistribute it and/or modify it under the terms of the
+ * GNU General Public License as published by the Free Software Foundation, version 3 or later.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with FlashString.
+ * If not, see <https://www.gnu.org/licenses/>.
+ *
+ ****/
+
+#pragma once
+
+#include "String.hpp"
+#include <WString.h>
+
+/**
+ * @brief Declare a global StringTable& reference
+ * @param name
+ * @note Use `DEFINE_FSTR_STRING_TABLE` to instantiate the global Object
+ */
+#define DECLARE_FSTR_STRING_TABLE(name) extern const FSTR::StringTable& name;
+
+/**
+ * @brief Define a StringTable Object with global reference
+ * @param name Name of StringTable& reference to define
+ * @param str Content of all strings, back-to-back
+ * @param ... Index, as produced by `tools/fsstrtab.py`
+ */
+#define DEFINE_FSTR_STRING_TABLE(name, str, ...)                                                                       \
+	static DEFINE_FSTR_STRING_TABLE_DATA(FSTR_DATA_NAME(name), uint16_t, str, __VA_ARGS__);                            \
+	DEFINE_FSTR_REF_NAMED(name, FSTR::StringTable);
+
+/**
+ * @brief Define a StringTable Object with local reference
+ * @param name Name of StringTable& reference to define
+ * @param str Content of all strings, back-to-back
+ * @param ... Index, as produced by `tools/fsstrtab.py`
+ */
+#define DEFINE_FSTR_STRING_TABLE_LOCAL(name, str, ...)                                                                 \
+	static DEFINE_FSTR_STRING_TABLE_DATA(FSTR_DATA_NAME(name), uint16_t, str, __VA_ARGS__);                            \
+	static constexpr DEFINE_FSTR_REF_NAMED(name, FSTR::StringTable);
+
+/**
+ * @brief Define a StringTable Object with global reference, where strings may share content
+ * @param name Name of StringTable& reference to define
+ * @param str Content of stored strings, back-to-back
+ * @param ... Index, as produced by `tools/fsstrtab.py`
+ */
+#define DEFINE_FSTR_STRING_TABLE_MERGED(name, str, ...)                                                                \
+	static DEFINE_FSTR_STRING_TABLE_DATA(FSTR_DATA_NAME(name), uint32_t, str, __VA_ARGS__);                            \
+	DEFINE_FSTR_REF_NAMED(name, FSTR::StringTable);
+
+/**
+ * @brief Define a StringTable Object with local reference, where strings may share content
+ * @param name Name of StringTable& reference to define
+ * @param str Content of stored strings, back-to-back
+ * @param ... Index, as produced by `tools/fsstrtab.py`
+ */
+#define DEFINE_FSTR_STRING_TABLE_MERGED_LOCAL(name, str, ...)                                                          \
+	static DEFINE_FSTR_STRING_TABLE_DATA(FSTR_DATA_NAME(name), uint32_t, str, __VA_ARGS__);                            \
+	static constexpr DEFINE_FSTR_REF_NAMED(name, FSTR::StringTable);
+
+/**
+ * @brief Get an index entry for a merged StringTable
+ * @param offset Offset of string from start of data
+ * @param length Length of string
+ */
+#define FSTR_STRING_TABLE_ENTRY(offset, length) ((uint32_t(length) << 22) | uint32_t(offset))
+
+/**
+ * @brief Define a StringTable data structure
+ * @param name Name of data structure
+ * @param IndexType uint16_t for a plain table, uint32_t for a merged table
+ * @param str Content of all strings, back-to-back
+ * @param ... Index values. For a plain table, the offset of each string from start of data followed by
+ * the offset of the end of the last string. For a merged table, the number of strings followed by
+ * an entry for each string.
+ * @note As for a String, content is NUL-terminated but the length does not include it
+ */
+#define DEFINE_FSTR_STRING_TABLE_DATA(name, IndexType, str, ...)                                                       \
+	constexpr const struct {                                                                                           \
+		FSTR::ObjectBase object;                                                                                       \
+		struct {                                                                                                       \
+			IndexType index[sizeof((const IndexType[]){__VA_ARGS__}) / sizeof(IndexType)];                             \
+			char chars[sizeof(str)];                                                                                   \
+		} data;                                                                                                        \
+	} FSTR_PACKED name PROGMEM = {                                                                                     \
+		{FSTR::ObjectBase::encodeLength(FSTR::Type::StringTable, sizeof(IndexType),                                    \
+										sizeof(name.data.index) + sizeof(str) - 1)},                                   \
+		{{__VA_ARGS__}, str}};                                                                                         \
+	FSTR_CHECK_STRUCT(name);                                                                                           \
+	static_assert(sizeof(IndexType) == sizeof(uint32_t)                                                                \
+					  ? name.data.index[0] * sizeof(IndexType) == sizeof(name.data.index) - sizeof(IndexType)          \
+					  : name.data.index[0] == sizeof(name.data.index),                                                 \
+				  "StringTable index does not match content");
+
+namespace FSTR
+{
+/**
+ * @brief A table of Strings stored back-to-back in a single object
+ * @note Each `DEFINE_FSTR` has a length word, NUL terminator and alignment padding, so a 1-character
+ * String occupies 8 bytes. Here each String costs only a 16-bit index entry, and related strings
+ * share cache lines.
+ *
+ * Generated at build time using `tools/fsstrtab.py`. Content of a plain table is:
+ *
+ * 		uint16_t index[count + 1];
+ * 		char chars[];
+ *
+ * String `i` occupies `index[i]` to `index[i + 1] - 1`, as offsets from the start of content.
+ * The first offset is therefore the size of the index. Content is limited to 64KB.
+ *
+ * Where strings are duplicated, or are the tail of other strings, the generator may instead produce
+ * a merged table which stores each distinct tail once:
+ *
+ * 		uint32_t count;
+ * 		uint32_t entry[count]; // Bits 0-21 offset, bits 22-31 length
+ * 		char chars[];
+ *
+ * Entries for identical strings are the same, so comparing them does not access the content.
+ * The recorded element size, 2 or 4, identifies the layout.
+ */
+class StringTable : public Object<StringTable, uint8_t>
+{
+public:
+	/**
+	 * @brief Get the number of Strings in the table
+	 */
+	size_t count() const
+	{
+		return getCount(isMerged());
+	}
+
+	/**
+	 * @brief Get the length of a String without accessing its content
+	 * @param index
+	 * @retval size_t 0 if index is out of range
+	 */
+	size_t stringLength(unsigned index) const
+	{
+		size_t offset;
+		size_t length;
+		return getEntry(isMerged(), index, offset, length) ? length : 0;
+	}
+
+	/**
+	 * @brief Get a String from the table
+	 * @param index
+	 * @retval Slice<String> Refers to the table content, no data is copied. Null if index is out of range.
+	 * @note The slice reports the type of the table, `Type::StringTable`, not `Type::String`.
+	 * A Variant constructed from it is therefore not a String: use the returned String directly.
+	 */
+	Slice<String> valueAt(unsigned index) const;
+
+	Slice<String> operator[](unsigned index) const
+	{
+		return valueAt(index);
+	}
+
+	/**
+	 * @brief Find a String in the table
+	 * @param str
+	 * @param length Length of str
+	 * @param ignoreCase Whether comparison is case-insensitive
+	 * @retval int Index of the first matching String, -1 if not found
+	 * @note Lengths are compared first, using only the index
+	 */
+	int indexOf(const char* str, size_t length, bool ignoreCase = false) const;
+
+	int indexOf(const char* str, bool ignoreCase = false) const
+	{
+		return indexOf(str, (str == nullptr) ? 0 : strlen(str), ignoreCase);
+	}
+
+	int indexOf(const WString& str, bool ignoreCase = false) const
+	{
+		return indexOf(str.c_str(), str.length(), ignoreCase);
+	}
+
+	/**
+	 * @brief Determine if strings may share content
+	 * @see See `DEFINE_FSTR_STRING_TABLE_MERGED`
+	 */
+	bool isMerged() const
+	{
+		return ObjectBase::elementSize() == sizeof(uint32_t);
+	}
+
+private:
+	static constexpr unsigned entryOffsetBits = 22;
+
+	template <typename T> T readIndex(unsigned index) const
+	{
+		return readValue(reinterpret_cast<const T*>(data()) + index);
+	}
+
+	size_t getCount(bool merged) const;
+
+	/*
+	 * Get location of a String within the table content, returns false if index is out of range
+	 */
+	bool getEntry(bool merged, unsigned index, size_t& offset, size_t& length) const;
+};
+
+} // namespace FSTR
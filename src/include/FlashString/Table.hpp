@@ -45,9 +45,24 @@ template <typename ElementType, size_t Columns> struct TableRow {
 		return Columns;
 	}
 
+	const ElementType* begin() const
+	{
+		return values;
+	}
+
+	const ElementType* end() const
+	{
+		return values + Columns;
+	}
+
+	FSTR::ArrayPrinter<TableRow> printer(const PrintFormat& format = defaultArrayFormat) const
+	{
+		return FSTR::ArrayPrinter<TableRow>(*this, format);
+	}
+
 	size_t printTo(Print& p) const
 	{
-		return FSTR::ArrayPrinter<TableRow>(*this, ", ").printTo(p);
+		return printer().printTo(p);
 	}
 
 	static TableRow empty()
@@ -0,0 +1,90 @@
+/**
+ * TemplateIndex.hpp - Defines the TemplateIndex class and associated macros
+ *
+ * Copyright 2019 mikee47 <mike@sillyhouse.net>
+ *
+ * This file is part of the FlashString Library
+ *
+ * This library is free software: you can redistribute it and/or modify it under the terms of the
+ * GNU General Public License as published by the Free Software Foundation, version 3 or later.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with FlashString.
+ * If not, see <https://www.gnu.org/licenses/>.
+ *
+ ****/
+
+#pragma once
+
+#include "Array.hpp"
+
+/**
+ * @brief Declare a global TemplateIndex& reference
+ * @param name
+ * @note Use `DEFINE_FSTR_TEMPLATE_INDEX` to instantiate the global Object
+ */
+#define DECLARE_FSTR_TEMPLATE_INDEX(name) extern const FSTR::TemplateIndex& name;
+
+/**
+ * @brief Define a TemplateIndex Object with global reference
+ * @param name Name of TemplateIndex& reference to define
+ * @param ... Index content, as produced by `tools/fsindex.py template`
+ */
+#define DEFINE_FSTR_TEMPLATE_INDEX(name, ...)                                                                          \
+	static DEFINE_FSTR_ARRAY_DATA(FSTR_DATA_NAME(name), uint32_t, __VA_ARGS__);                                        \
+	DEFINE_FSTR_REF_NAMED(name, FSTR::TemplateIndex);
+
+/**
+ * @brief Define a TemplateIndex Object with local reference
+ * @param name Name of TemplateIndex& reference to define
+ * @param ... Index content, as produced by `tools/fsindex.py template`
+ */
+#define DEFINE_FSTR_TEMPLATE_INDEX_LOCAL(name, ...)                                                                    \
+	static DEFINE_FSTR_ARRAY_DATA(FSTR_DATA_NAME(name), uint32_t, __VA_ARGS__);                                        \
+	static constexpr DEFINE_FSTR_REF_NAMED(name, FSTR::TemplateIndex);
+
+namespace FSTR
+{
+/**
+ * @brief Records the position of each placeholder in template content
+ * @note Index is generated at build time from the template content. Each placeholder is described
+ * by two uint32_t values:
+ *
+ * 		offset, tagLength | (nameOffset << 16) | (nameLength << 24)
+ *
+ * Placeholders are stored in order of increasing offset.
+ */
+class TemplateIndex : public Object<TemplateIndex, uint32_t>
+{
+public:
+	struct Tag {
+		uint32_t offset;	///< Position of tag in content
+		uint16_t length;	///< Length of tag, including braces
+		uint8_t nameOffset; ///< Position of name within tag
+		uint8_t nameLength;
+	};
+
+	/**
+	 * @brief Get the number of placeholders
+	 */
+	unsigned count() const
+	{
+		return length() / 2;
+	}
+
+	/**
+	 * @brief Get details of a placeholder
+	 * @param index Must be less than `count()`
+	 */
+	Tag getTag(unsigned index) const
+	{
+		auto view = this->view();
+		auto info = view.valueAt(index * 2 + 1);
+		return Tag{view.valueAt(index * 2), uint16_t(info), uint8_t(info >> 16), uint8_t(info >> 24)};
+	}
+};
+
+} // namespace FSTR
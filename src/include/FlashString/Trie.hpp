@@ -0,0 +1,148 @@
+/**
+ * Trie.hpp - Defines the Trie class and associated macros
+ *
+ * Copyright 2019 mikee47 <mike@sillyhouse.net>
+ *
+ * This file is part of the FlashString Library
+ *
+ * This library is free software: you can redistribute it and/or modify it under the terms of the
+ * GNU General Public License as published by the Free Software Foundation, version 3 or later.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with FlashString.
+ * If not, see <https://www.gnu.org/licenses/>.
+ *
+ ****/
+
+#pragma once
+
+#include "String.hpp"
+#include <WString.h>
+#include "Array.hpp"
+
+/**
+ * @brief Declare a global Trie& reference
+ * @param name
+ * @note Use `DEFINE_FSTR_TRIE` to instantiate the global Object
+ */
+#define DECLARE_FSTR_TRIE(name) extern const FSTR::Trie& name;
+
+/**
+ * @brief Define a Trie Object with global reference
+ * @param name Name of Trie& reference to define
+ * @param ... Trie content, as produced by `tools/fsindex.py trie`
+ */
+#define DEFINE_FSTR_TRIE(name, ...)                                                                                    \
+	static DEFINE_FSTR_ARRAY_DATA(FSTR_DATA_NAME(name), uint8_t, __VA_ARGS__);                                         \
+	DEFINE_FSTR_REF_NAMED(name, FSTR::Trie);
+
+/**
+ * @brief Define a Trie Object with local reference
+ * @param name Name of Trie& reference to define
+ * @param ... Trie content, as produced by `tools/fsindex.py trie`
+ */
+#define DEFINE_FSTR_TRIE_LOCAL(name, ...)                                                                              \
+	static DEFINE_FSTR_ARRAY_DATA(FSTR_DATA_NAME(name), uint8_t, __VA_ARGS__);                                         \
+	static constexpr DEFINE_FSTR_REF_NAMED(name, FSTR::Trie);
+
+namespace FSTR
+{
+/**
+ * @brief A compressed (radix) trie for prefix matching of String keys
+ * @note Generated at build time from a list of keys. Each key is associated with a value,
+ * its index in the list, so the keys should be listed in the same order as the object
+ * being indexed (e.g. a Map).
+ *
+ * Lookup cost depends on the length of the key, not the number of entries.
+ *
+ * Content is a byte stream: a 4-byte header (flags, reserved) followed by nodes, starting with the root:
+ *
+ * 		uint8_t labelLength;
+ * 		char label[labelLength];
+ * 		uint8_t flags;
+ * 		uint16_t value; // Only present if flagTerminal is set
+ * 		uint8_t childCount;
+ * 		struct {
+ * 			char firstChar; // First character of child label
+ * 			uint8_t offset[3]; // Offset of child node from start of content
+ * 		} children[childCount]; // Sorted by firstChar
+ *
+ * Multi-byte values are little-endian.
+ */
+class Trie : public Object<Trie, uint8_t>
+{
+public:
+	enum Flag {
+		flagIgnoreCase = 0x01, ///< Header: keys are folded to lower case
+		flagTerminal = 0x01,   ///< Node: node marks the end of a key
+	};
+
+	/**
+	 * @brief Determine if the trie was generated for case-insensitive lookups
+	 */
+	bool ignoreCase() const
+	{
+		return length() >= headerSize && (valueAt(0) & flagIgnoreCase) != 0;
+	}
+
+	/**
+	 * @brief Find the longest key which is a prefix of the given string
+	 * @param str For example, a request path
+	 * @param length Length of str
+	 * @param matchLength On success, receives length of the matched key (optional)
+	 * @retval int Index of the matching key, -1 if there is no match
+	 */
+	int longestPrefix(const char* str, size_t length, size_t* matchLength = nullptr) const;
+
+	int longestPrefix(const char* str, size_t* matchLength = nullptr) const
+	{
+		return longestPrefix(str, (str == nullptr) ? 0 : strlen(str), matchLength);
+	}
+
+	int longestPrefix(const WString& str, size_t* matchLength = nullptr) const
+	{
+		return longestPrefix(str.c_str(), str.length(), matchLength);
+	}
+
+	/**
+	 * @brief Find a key which starts with the given prefix
+	 * @param prefix
+	 * @param length Length of prefix
+	 * @retval int Index of the first such key in sorted order, -1 if there are none
+	 */
+	int startsWith(const char* prefix, size_t length) const;
+
+	int startsWith(const char* prefix) const
+	{
+		return startsWith(prefix, (prefix == nullptr) ? 0 : strlen(prefix));
+	}
+
+	int startsWith(const WString& prefix) const
+	{
+		return startsWith(prefix.c_str(), prefix.length());
+	}
+
+private:
+	static constexpr unsigned headerSize = 4;
+
+	/*
+	 * Match the label of the node at `offset` against `str`.
+	 * Returns number of characters matched.
+	 */
+	size_t matchLabel(unsigned offset, const char* str, size_t length, bool ignoreCase) const;
+
+	/*
+	 * Locate child of node at `offset` whose label starts with `c`, return its offset or 0 if not found
+	 */
+	unsigned findChild(unsigned offset, uint8_t c) const;
+
+	/*
+	 * Return value of first key in the sub-tree at `offset`
+	 */
+	int firstValue(unsigned offset) const;
+};
+
+} // namespace FSTR
@@ -0,0 +1,87 @@
+/**
+ * Type.hpp - Type information stored with flash objects
+ *
+ * Copyright 2019 mikee47 <mike@sillyhouse.net>
+ *
+ * This file is part of the FlashString Library
+ *
+ * This library is free software: you can redistribute it and/or modify it under the terms of the
+ * GNU General Public License as published by the Free Software Foundation, version 3 or later.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with FlashString.
+ * If not, see <https://www.gnu.org/licenses/>.
+ *
+ ****/
+
+#pragma once
+
+#include "config.hpp"
+#include <type_traits>
+
+/**
+ * @brief Type information for imported objects, for use in assembler
+ * @note Values are checked against `ObjectBase::encodeLength()`
+ * @{
+ */
+#define FSTR_IMPORT_TYPE_STRING 0x02400000
+#define FSTR_IMPORT_TYPE_COMPRESSED 0x18400000
+/** @} */
+
+namespace FSTR
+{
+class String;
+
+/**
+ * @brief Identifies the type of a flash object at runtime
+ * @note Stored in the object header, see `ObjectBase::type()`
+ */
+enum class Type : uint8_t {
+	Unknown = 0,		///< Not recorded, e.g. user-defined structures or imported arrays
+	String,				///< String
+	Signed,				///< Array of signed integers
+	Unsigned,			///< Array of unsigned integers
+	Float,				///< Array of float or double
+	Bool,				///< Array of bool
+	Enum,				///< Array of enumerated values
+	Struct,				///< Array of structures
+	Vector,				///< Vector of object pointers
+	Map,				///< Map with String keys
+	HashedMap,			///< Map with String keys and key hashes
+	IntegerMap,			///< Map with integral or enum keys
+	Compressed,			///< CompressedObject
+	StringTable,		///< StringTable
+	UserDefined = 16,	///< Start of user-defined types
+	MaxType = 31,
+};
+
+/**
+ * @brief Get the type recorded for an Array
+ * @tparam ElementType Type of array element
+ */
+template <typename ElementType> constexpr Type arrayType()
+{
+	return std::is_same<ElementType, bool>::value
+			   ? Type::Bool
+			   : std::is_enum<ElementType>::value
+					 ? Type::Enum
+					 : std::is_floating_point<ElementType>::value
+						   ? Type::Float
+						   : std::is_integral<ElementType>::value
+								 ? (std::is_signed<ElementType>::value ? Type::Signed : Type::Unsigned)
+								 : Type::Struct;
+}
+
+/**
+ * @brief Get the type recorded for a Map
+ * @tparam KeyType Type of key
+ */
+template <typename KeyType> constexpr Type mapType()
+{
+	return std::is_same<KeyType, String>::value ? Type::Map : Type::IntegerMap;
+}
+
+} // namespace FSTR
@@ -66,34 +66,81 @@ template <typename T, typename U> struct argument_type<T(U)> {
  * @note No C/C++ symbol is declared, this is type-dependent and must be done separately:
  * 			extern "C" FSTR::String myFlashData;
  * @note If the symbol is not referenced the content will be discarded by the linker.
+ *
+ * IMPORT_FSTR_DATA_HASHED() also imports `file.hash`, produced by `tools/fshash.py`, immediately
+ * before the object. The length word is flagged so that `ObjectBase::contentHash()` can locate it.
+ * IMPORT_FSTR_DATA_WITH_HASH() is the same, but the location of the hash file is given explicitly.
+ *
+ * Files are limited to 4MB (see `ObjectBase::maxLength`), larger files cause an assembler error.
+ *
+ * The `_TYPED` variants also record type information (see `ObjectBase::type()`), given as a literal
+ * value such as FSTR_IMPORT_TYPE_STRING. Otherwise the type is `Type::Unknown`.
  */
 // clang-format off
 #define STR(x) XSTR(x)
 #define XSTR(x) #x
 #ifdef __WIN32
-#define IMPORT_FSTR_DATA(name, file)                                                                                   \
+#define IMPORT_FSTR_DATA(name, file) IMPORT_FSTR_DATA_TYPED(name, file, 0)
+#define IMPORT_FSTR_DATA_TYPED(name, file, type)                                                                       \
 	__asm__(".section .rodata\n"                                                                                       \
 			".global _" STR(name) "\n"                                                                                 \
 			".def _" STR(name) "; .scl 2; .type 32; .endef\n"                                                          \
 			".align 4\n"                                                                                               \
 			"_" STR(name) ":\n"                                                                                        \
-			".long _" STR(name) "_end - _" STR(name) " - 4\n"                                                          \
+			".long _" STR(name) "_end - _" STR(name) " - 4 + " STR(type) "\n"                                          \
+			".incbin \"" file "\"\n"                                                                                   \
+			"_" STR(name) "_end:\n"                                                                                    \
+			".if (_" STR(name) "_end - _" STR(name) " - 4) > 0x3fffff\n"                                               \
+			".error \"Imported file too large, limit is 4MB: " file "\"\n"                                             \
+			".endif\n");
+#define IMPORT_FSTR_DATA_HASHED(name, file) IMPORT_FSTR_DATA_WITH_HASH(name, file, file ".hash")
+#define IMPORT_FSTR_DATA_WITH_HASH(name, file, hashFile) IMPORT_FSTR_DATA_WITH_HASH_TYPED(name, file, hashFile, 0)
+#define IMPORT_FSTR_DATA_WITH_HASH_TYPED(name, file, hashFile, type)                                                   \
+	__asm__(".section .rodata\n"                                                                                       \
+			".align 4\n"                                                                                               \
+			".incbin \"" hashFile "\"\n"                                                                               \
+			".global _" STR(name) "\n"                                                                                 \
+			".def _" STR(name) "; .scl 2; .type 32; .endef\n"                                                          \
+			"_" STR(name) ":\n"                                                                                        \
+			".long _" STR(name) "_end - _" STR(name) " - 4 + 0x40000000 + " STR(type) "\n"                             \
 			".incbin \"" file "\"\n"                                                                                   \
-			"_" STR(name) "_end:\n");
+			"_" STR(name) "_end:\n"                                                                                    \
+			".if (_" STR(name) "_end - _" STR(name) " - 4) > 0x3fffff\n"                                               \
+			".error \"Imported file too large, limit is 4MB: " file "\"\n"                                             \
+			".endif\n");
 #else
 #ifdef ARCH_HOST
 #define IROM_SECTION ".rodata"
 #else
 #define IROM_SECTION ".irom0.text"
 #endif
-#define IMPORT_FSTR_DATA(name, file)                                                                                   \
+#define IMPORT_FSTR_DATA(name, file) IMPORT_FSTR_DATA_TYPED(name, file, 0)
+#define IMPORT_FSTR_DATA_TYPED(name, file, type)                                                                       \
 	__asm__(".section " IROM_SECTION "\n"                                                                              \
 			".global " STR(name) "\n"                                                                                  \
 			".type " STR(name) ", @object\n"                                                                           \
 			".align 4\n" STR(name) ":\n"                                                                               \
-			".long _" STR(name) "_end - " STR(name) " - 4\n"                                                           \
+			".long _" STR(name) "_end - " STR(name) " - 4 + " STR(type) "\n"                                           \
+			".incbin \"" file "\"\n"                                                                                   \
+			"_" STR(name) "_end:\n"                                                                                    \
+			".if (_" STR(name) "_end - " STR(name) " - 4) > 0x3fffff\n"                                                \
+			".error \"Imported file too large, limit is 4MB: " file "\"\n"                                             \
+			".endif\n");
+#define IMPORT_FSTR_DATA_HASHED(name, file) IMPORT_FSTR_DATA_WITH_HASH(name, file, file ".hash")
+#define IMPORT_FSTR_DATA_WITH_HASH(name, file, hashFile) IMPORT_FSTR_DATA_WITH_HASH_TYPED(name, file, hashFile, 0)
+#define IMPORT_FSTR_DATA_WITH_HASH_TYPED(name, file, hashFile, type)                                                   \
+	__asm__(".section " IROM_SECTION "\n"                                                                              \
+			".align 4\n"                                                                                               \
+			".incbin \"" hashFile "\"\n"                                                                               \
+			".global " STR(name) "\n"                                                                                  \
+			".type " STR(name) ", @object\n"                                                                           \
+			STR(name) ":\n"                                                                                            \
+			".long _" STR(name) "_end - " STR(name) " - 4 + 0x40000000 + " STR(type) "\n"                              \
 			".incbin \"" file "\"\n"                                                                                   \
-			"_" STR(name) "_end:\n");
+			"_" STR(name) "_end:\n"                                                                                    \
+			".if (_" STR(name) "_end - " STR(name) " - 4) > 0x3fffff\n"                                                \
+			".error \"Imported file too large, limit is 4MB: " file "\"\n"                                             \
+			".endif\n");
 #endif
 // clang-format on
 
@@ -0,0 +1,298 @@
+/**
+ * Variant.hpp - Defines the Variant class
+ *
+ * Copyright 2019 mikee47 <mike@sillyhouse.net>
+ *
+ * This file is part of the FlashString Library
+ *
+ * This library is free software: you can redistribute it and/or modify it under the terms of the
+ * GNU General Public License as published by the Free Software Foundation, version 3 or later.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with FlashString.
+ * If not, see <https://www.gnu.org/licenses/>.
+ *
+ ****/
+
+#pragma once
+
+#include "String.hpp"
+#include "Array.hpp"
+#include "Print.hpp"
+#include <WString.h>
+#include <iterator>
+
+namespace FSTR
+{
+/**
+ * @brief Interprets any flash object at runtime, using the type information stored with it
+ * @note A Variant is a small RAM object referring to data in flash. It may be freely copied.
+ * No data is copied and no heap is used.
+ *
+ * For example, with a document translated by `tools/json2fstr.py`:
+ *
+ * 		FSTR::Variant doc(config);
+ * 		String ssid = doc["network"]["ssid"].asString();
+ * 		for(auto device : doc["devices"]) {
+ * 			FSTR::println(Serial, device["label"]);
+ * 		}
+ *
+ * Lookups on anything other than a Vector or Map return a null Variant, as do failed lookups,
+ * so expressions may be chained without checking each step.
+ */
+class Variant
+{
+public:
+	class Iterator;
+
+	typedef void (Variant::*IfHelperType)() const;
+	void IfHelper() const
+	{
+	}
+
+	/**
+	 * @brief Construct a null Variant
+	 */
+	Variant() = default;
+
+	/**
+	 * @brief Construct a Variant referring to an object
+	 * @note The object must outlive the Variant. For a copy, the Variant refers to the copy.
+	 */
+	Variant(const ObjectBase& object) : object(&object)
+	{
+	}
+
+	/**
+	 * @brief Provides bool() operator to determine if Variant is valid
+	 */
+	operator IfHelperType() const
+	{
+		return isNull() ? 0 : &Variant::IfHelper;
+	}
+
+	/**
+	 * @brief Get the object type
+	 * @retval Type Type::Unknown if the Variant is null, or the object was defined without type information
+	 */
+	Type type() const
+	{
+		return (object == nullptr) ? Type::Unknown : object->type();
+	}
+
+	/**
+	 * @brief Determine if the Variant does not refer to an object
+	 * @note This is the case for failed lookups, and for null values in translated documents
+	 */
+	bool isNull() const
+	{
+		return object == nullptr || object->isNull();
+	}
+
+	bool isString() const
+	{
+		return type() == Type::String;
+	}
+
+	/**
+	 * @brief Determine if object is an Array of scalars or structures
+	 */
+	bool isArray() const
+	{
+		auto t = type();
+		return t >= Type::Signed && t <= Type::Struct;
+	}
+
+	bool isVector() const
+	{
+		return type() == Type::Vector;
+	}
+
+	/**
+	 * @brief Determine if object is a Map of any kind
+	 */
+	bool isMap() const
+	{
+		auto t = type();
+		return t == Type::Map || t == Type::HashedMap || t == Type::IntegerMap;
+	}
+
+	/**
+	 * @brief Get the number of elements
+	 * @retval size_t Number of characters in a String, elements in an Array, entries in a Vector or Map.
+	 * 0 if the element size is not known, or for a StringTable.
+	 */
+	size_t length() const;
+
+	/**
+	 * @brief Get the String this Variant refers to
+	 * @retval String& A null String if this is not a String
+	 */
+	const String& asString() const
+	{
+		return isString() ? object->as<String>() : String::empty();
+	}
+
+	/**
+	 * @brief Get the Array this Variant refers to
+	 * @tparam ElementType Must match the type of Array which was defined
+	 * @retval Array& A null Array if this is not an Array of the given type
+	 */
+	template <typename ElementType> const Array<ElementType>& asArray() const
+	{
+		if(type() == arrayType<ElementType>() && object->ObjectBase::elementSize() == sizeof(ElementType)) {
+			return object->as<Array<ElementType>>();
+		}
+		return Array<ElementType>::empty();
+	}
+
+	/**
+	 * @brief Get the underlying object, without checking the type
+	 */
+	const ObjectBase& asObject() const
+	{
+		return (object == nullptr) ? String::empty() : *object;
+	}
+
+	/**
+	 * @brief Get an entry from a Vector, or the content of an entry in a Map
+	 * @param index
+	 * @retval Variant Null if index is out of range, or object is not a Vector or Map
+	 */
+	Variant valueAt(unsigned index) const;
+
+	Variant operator[](unsigned index) const
+	{
+		return valueAt(index);
+	}
+
+	Variant operator[](int index) const
+	{
+		return valueAt(index);
+	}
+
+	/**
+	 * @brief Get the content of an entry in a Map with String keys
+	 * @param key
+	 * @param keyLength
+	 * @retval Variant Null if key is not found, or object is not a Map with String keys
+	 * @note Lookup is case-insensitive
+	 */
+	Variant get(const char* key, size_t keyLength) const;
+
+	Variant operator[](const char* key) const
+	{
+		return get(key, (key == nullptr) ? 0 : strlen(key));
+	}
+
+	Variant operator[](const WString& key) const
+	{
+		return get(key.c_str(), key.length());
+	}
+
+	Variant operator[](const String& key) const
+	{
+		LOAD_FSTR(buf, key);
+		return get(buf, key.length());
+	}
+
+	/**
+	 * @brief Get the key for a Variant obtained from a Map with String keys
+	 * @retval String& A null String if there is no key
+	 */
+	const String& key() const
+	{
+		return (key_ == nullptr) ? String::empty() : *key_;
+	}
+
+	Iterator begin() const;
+	Iterator end() const;
+
+	/**
+	 * @brief Print the value of a String or Array
+	 * @note Nothing is printed for other types
+	 */
+	size_t printTo(Print& p) const;
+
+	/**
+	 * @brief Compare content with a String
+	 */
+	bool operator==(const char* str) const
+	{
+		return asString() == str;
+	}
+
+	bool operator!=(const char* str) const
+	{
+		return !operator==(str);
+	}
+
+private:
+	Variant(const ObjectBase* object, const String* key) : object(object), key_(key)
+	{
+	}
+
+	const ObjectBase* readPointer(size_t offset) const;
+
+	const ObjectBase* object = nullptr;
+	const String* key_ = nullptr;
+};
+
+/**
+ * @brief Iterates through entries in a Vector or Map
+ * @note For any other object type, no entries are returned
+ */
+class Variant::Iterator : public std::iterator<std::forward_iterator_tag, Variant>
+{
+public:
+	Iterator(const Variant& container, unsigned index) : container(container), index(index)
+	{
+	}
+
+	Iterator& operator++()
+	{
+		++index;
+		return *this;
+	}
+
+	Iterator operator++(int)
+	{
+		Iterator tmp(*this);
+		++index;
+		return tmp;
+	}
+
+	bool operator==(const Iterator& rhs) const
+	{
+		return index == rhs.index;
+	}
+
+	bool operator!=(const Iterator& rhs) const
+	{
+		return index != rhs.index;
+	}
+
+	Variant operator*() const
+	{
+		return container.valueAt(index);
+	}
+
+private:
+	Variant container;
+	unsigned index;
+};
+
+inline Variant::Iterator Variant::begin() const
+{
+	return Iterator(*this, 0);
+}
+
+inline Variant::Iterator Variant::end() const
+{
+	return Iterator(*this, (isVector() || isMap()) ? length() : 0);
+}
+
+} // namespace FSTR
@@ -23,6 +23,7 @@
 
 #include "Object.hpp"
 #include "ArrayPrinter.hpp"
+#include "LengthIndex.hpp"
 
 /**
  * @brief Declare a global Vector& reference
@@ -100,7 +101,8 @@
 	constexpr const struct {                                                                                           \
 		FSTR::ObjectBase object;                                                                                       \
 		const ObjectType* data[size];                                                                                  \
-	} name PROGMEM = {{sizeof(name.data)}, __VA_ARGS__};                                                               \
+	} name PROGMEM = {                                                                                                 \
+		{FSTR::ObjectBase::encodeLength(FSTR::Type::Vector, sizeof(void*), sizeof(name.data))}, __VA_ARGS__};          \
 	FSTR_CHECK_STRUCT(name);
 
 namespace FSTR
@@ -119,9 +121,10 @@ public:
 			return Object<Vector<String>, String*>::indexOf(value);
 		}
 
-		auto len = this->length();
+		auto v = this->view();
+		auto len = v.length();
 		for(unsigned i = 0; i < len; ++i) {
-			if(valueAt(i).equalsIgnoreCase(value)) {
+			if(readElement(v, i).equalsIgnoreCase(value)) {
 				return i;
 			}
 		}
@@ -129,16 +132,73 @@ public:
 		return -1;
 	}
 
-	const ObjectType& valueAt(unsigned index) const
+	/**
+	 * @brief Lookup a String using a length index
+	 * @param value
+	 * @param valueLength
+	 * @param index Generated from the Vector content using `tools/fsindex.py length`
+	 * @param ignoreCase Whether search is case-sensitive (default: true)
+	 * @retval int If value isn't found, return -1
+	 * @note Only entries of the same length as value are compared
+	 */
+	template <typename T = ObjectType>
+	typename std::enable_if<std::is_same<T, String>::value, int>::type
+	indexOf(const char* value, size_t valueLength, const LengthIndex& index, bool ignoreCase = true) const
 	{
-		if(index < this->length()) {
-			auto ptr = this->data()[index];
-			if(ptr != nullptr) {
-				return *ptr;
+		if(value == nullptr) {
+			valueLength = 0;
+		}
+		auto v = this->view();
+		unsigned pos, count;
+		index.getRange(valueLength, pos, count);
+		for(; count != 0; --count, ++pos) {
+			auto i = index.candidate(pos);
+			auto& str = readElement(v, i);
+			if(str.length() == valueLength && str.compare(value, valueLength, ignoreCase) == 0) {
+				return i;
 			}
 		}
 
-		return ObjectType::empty();
+		return -1;
+	}
+
+	template <typename T = ObjectType>
+	typename std::enable_if<std::is_same<T, String>::value, int>::type
+	indexOf(const char* value, const LengthIndex& index, bool ignoreCase = true) const
+	{
+		return indexOf(value, (value == nullptr) ? 0 : strlen(value), index, ignoreCase);
+	}
+
+	template <typename T = ObjectType>
+	typename std::enable_if<std::is_same<T, String>::value, int>::type
+	indexOf(const WString& value, const LengthIndex& index, bool ignoreCase = true) const
+	{
+		return indexOf(value.c_str(), value.length(), index, ignoreCase);
+	}
+
+	template <typename T = ObjectType>
+	typename std::enable_if<std::is_same<T, String>::value, int>::type
+	indexOf(const String& value, const LengthIndex& index, bool ignoreCase = true) const
+	{
+		LOAD_FSTR(buf, value);
+		return indexOf(buf, value.length(), index, ignoreCase);
+	}
+
+	using View = typename Object<Vector<ObjectType>, ObjectType*>::View;
+
+	/**
+	 * @brief Read an entry using a view
+	 * @retval const ObjectType& Entry, or an empty object for a nullptr entry
+	 */
+	static const ObjectType& readElement(const View& view, unsigned index)
+	{
+		auto ptr = view.valueAt(index);
+		return (ptr == nullptr) ? ObjectType::empty() : *ptr;
+	}
+
+	const ObjectType& valueAt(unsigned index) const
+	{
+		return readElement(this->view(), index);
 	}
 
 	const ObjectType& operator[](unsigned index) const
@@ -148,7 +208,17 @@ public:
 
 	/* Arduino Print support */
 
-	ArrayPrinter<Vector> printer(const WString& separator = ", ") const
+	ArrayPrinter<Vector> printer(const PrintFormat& format = defaultArrayFormat) const
+	{
+		return ArrayPrinter<Vector>(*this, format);
+	}
+
+	ArrayPrinter<Vector> printer(const char* separator) const
+	{
+		return ArrayPrinter<Vector>(*this, separator);
+	}
+
+	ArrayPrinter<Vector> printer(const WString& separator) const
 	{
 		return ArrayPrinter<Vector>(*this, separator);
 	}
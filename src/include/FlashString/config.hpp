@@ -26,3 +26,17 @@
 
 #define FSTR_INLINE __attribute__((always_inline)) inline
 #define FSTR_PACKED __attribute__((packed)) __attribute__((aligned(4)))
+
+/**
+ * @brief Default size of the stack buffer used when printing a String
+ */
+#ifndef FSTR_PRINT_CHUNK_SIZE
+#define FSTR_PRINT_CHUNK_SIZE 256
+#endif
+
+/**
+ * @brief Strings no longer than this are printed by reading via the cache, otherwise `readFlash()` is used
+ */
+#ifndef FSTR_PRINT_CACHE_THRESHOLD
+#define FSTR_PRINT_CACHE_THRESHOLD 64
+#endif
@@ -85,6 +85,45 @@ public:
 			Serial.print(", ");
 		}
 		Serial.println();
+
+		TEST_CASE("Formatted printing")
+		{
+			constexpr FSTR::PrintFormat hexFormat{16, 2, 0, " ", "<", ">"};
+
+			PrintCapture capture;
+			int64Array.printer(hexFormat).printTo(capture);
+			REQUIRE(capture.content == F("<01 02 03 04 05>"));
+
+			capture.content = nullptr;
+			tableArray.printer(FSTR::PrintFormat{10, 0, 1, ",", "(", ")"}).printTo(capture);
+			REQUIRE(capture.content == F("((1.0,2.0,3.0),(4.0,5.0,6.0),(7.0,8.0,9.0))"));
+
+			capture.content = nullptr;
+			int64Array.printer(" | ").printTo(capture);
+			REQUIRE(capture.content == F("[1 | 2 | 3 | 4 | 5]"));
+
+			// Printer keeps its own copy of a WString separator
+			capture.content = nullptr;
+			auto printer = int64Array.printer(String(F(" / ")));
+			printer.printTo(capture);
+			REQUIRE(capture.content == F("[1 / 2 / 3 / 4 / 5]"));
+		}
+
+		TEST_CASE("Slice")
+		{
+			auto slice = int64Array.slice(1, 3);
+			REQUIRE(slice.length() == 3);
+			REQUIRE(slice[0] == 2);
+			REQUIRE(slice[2] == 4);
+			REQUIRE(int64Array.slice(3).length() == 2);
+			REQUIRE(int64Array.slice(10).length() == 0);
+
+			int64_t sum = 0;
+			for(auto v : slice) {
+				sum += v;
+			}
+			REQUIRE(sum == 9);
+		}
 	}
 };
 
@@ -0,0 +1,142 @@
+/**
+ * compressed.cpp - Compressed object tests
+ *
+ * Copyright 2019 mikee47 <mike@sillyhouse.net>
+ *
+ * This file is part of the FlashString Library
+ *
+ * This library is free software: you can redistribute it and/or modify it under the terms of the
+ * GNU General Public License as published by the Free Software Foundation, version 3 or later.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with FlashString.
+ * If not, see <https://www.gnu.org/licenses/>.
+ *
+ ****/
+
+#include <SmingTest.h>
+#include <FlashString/String.hpp>
+#include <FlashString/DecompressStream.hpp>
+#include <FlashString/Stream.hpp>
+
+/*
+ * Generated using `tools/fscompress.py --window-bits 9 compressed.txt compressed.fsz`.
+ * The small window ensures some seeks require decompression to restart.
+ */
+IMPORT_FSTR_COMPRESSED(compressedObject, COMPONENT_PATH "/files/compressed.fsz");
+// As above, with `--block-size 1024`
+IMPORT_FSTR_COMPRESSED(compressedBlocks, COMPONENT_PATH "/files/compressed-blocks.fsz");
+IMPORT_FSTR(compressedText, COMPONENT_PATH "/files/compressed.txt");
+
+class CompressedTest : public TestGroup
+{
+public:
+	CompressedTest() : TestGroup(_F("Compressed Objects"))
+	{
+	}
+
+	void execute() override
+	{
+		TEST_CASE("Header")
+		{
+			FSTR::CompressedObject::Header header;
+			REQUIRE(compressedObject.getHeader(header));
+			REQUIRE(header.encoding == FSTR::CompressedObject::Encoding::gzip);
+			REQUIRE(header.windowBits == 9);
+			REQUIRE(compressedObject.originalLength() == compressedText.length());
+			REQUIRE(compressedObject.length() < compressedText.length());
+		}
+
+		TEST_CASE("Read all")
+		{
+			FSTR::DecompressStream stream(compressedObject);
+			REQUIRE(stream.isValid());
+			REQUIRE(size_t(stream.available()) == compressedText.length());
+			String s;
+			REQUIRE(s.reserve(compressedText.length()));
+			char buf[100];
+			while(!stream.isFinished()) {
+				auto len = stream.readMemoryBlock(buf, sizeof(buf));
+				REQUIRE(len != 0);
+				s.concat(buf, len);
+				stream.seek(len);
+			}
+			REQUIRE(compressedText == s);
+		}
+
+		TEST_CASE("Seek")
+		{
+			checkSeek(compressedObject);
+		}
+
+		TEST_CASE("Seek blocks")
+		{
+			checkSeek(compressedBlocks);
+		}
+
+		TEST_CASE("Random access")
+		{
+			FSTR::CompressedObject::Header header;
+			REQUIRE(compressedBlocks.getHeader(header));
+			REQUIRE(header.blockSize == 1024);
+			REQUIRE(compressedBlocks.getBlockCount(header) == 15);
+
+			// Spans a block boundary
+			char buf[100];
+			REQUIRE(compressedBlocks.read(2000, buf, sizeof(buf)) == sizeof(buf));
+			char ref[100];
+			compressedText.read(2000, ref, sizeof(ref));
+			REQUIRE(memcmp(buf, ref, sizeof(buf)) == 0);
+
+			// Non-block objects work the same, but must decompress everything before the data
+			REQUIRE(compressedObject.read(2000, buf, sizeof(buf)) == sizeof(buf));
+			REQUIRE(memcmp(buf, ref, sizeof(buf)) == 0);
+
+			auto len = compressedText.length();
+			REQUIRE(compressedBlocks.read(len - 10, buf, sizeof(buf)) == 10);
+			REQUIRE(compressedBlocks.read(len, buf, sizeof(buf)) == 0);
+		}
+
+		TEST_CASE("Passthrough")
+		{
+			FSTR::Stream stream(compressedObject);
+			REQUIRE(stream.getEncoding() == FSTR::Stream::Encoding::gzip);
+			FSTR::CompressedObject::Header header;
+			REQUIRE(compressedObject.getHeader(header));
+			REQUIRE(size_t(stream.available()) == compressedObject.length() - compressedObject.gzipOffset(header));
+			uint8_t buf[10];
+			REQUIRE(stream.readMemoryBlock(reinterpret_cast<char*>(buf), sizeof(buf)) == sizeof(buf));
+			// gzip magic, deflate method
+			REQUIRE(buf[0] == 0x1f && buf[1] == 0x8b && buf[2] == 8);
+
+			FSTR::Stream textStream(compressedText);
+			REQUIRE(textStream.getEncoding() == FSTR::Stream::Encoding::none);
+		}
+	}
+
+private:
+	void checkSeek(const FSTR::CompressedObject& object)
+	{
+		FSTR::DecompressStream stream(object);
+		// Forward, back within window, then back to start
+		const size_t positions[]{5000, 4800, 12000, 100, 0, 14000};
+		for(auto pos : positions) {
+			REQUIRE(stream.seekFrom(pos, SEEK_SET) == int(pos));
+			char buf[64];
+			auto len = stream.readMemoryBlock(buf, sizeof(buf));
+			REQUIRE(len == sizeof(buf));
+			char ref[64];
+			compressedText.read(pos, ref, sizeof(ref));
+			REQUIRE(memcmp(buf, ref, len) == 0);
+		}
+		REQUIRE(stream.seekFrom(compressedText.length() + 1, SEEK_SET) < 0);
+	}
+};
+
+void REGISTER_TEST(compressed)
+{
+	registerGroup<CompressedTest>();
+}
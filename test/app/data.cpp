@@ -28,6 +28,35 @@
 
 DEFINE_FSTR(externalFSTR1, EXTERNAL_FSTR1_TEXT)
 
+// Generated using `tools/fsstrtab.py --name stringTable test/files/labels.txt`, do not edit
+DEFINE_FSTR_STRING_TABLE(stringTable,
+	"Temperature" // 0
+	"Humidity" // 1
+	"A" // 2
+	"" // 3
+	"Wind speed" // 4
+	"Pressure", // 5
+	14, 25, 33, 34, 34, 44, 52);
+
+// Generated using `tools/fsstrtab.py --name messageTable test/files/messages.txt`, do not edit
+DEFINE_FSTR_STRING_TABLE_MERGED(messageTable,
+	"ReadError" // 0, 2, 5
+	"WriteError" // 1
+	"index.html" // 3, 4, 9
+	"OK" // 6, 8
+	"error", // 7
+	10,
+	FSTR_STRING_TABLE_ENTRY(44, 9),
+	FSTR_STRING_TABLE_ENTRY(53, 10),
+	FSTR_STRING_TABLE_ENTRY(48, 5),
+	FSTR_STRING_TABLE_ENTRY(63, 10),
+	FSTR_STRING_TABLE_ENTRY(68, 5),
+	FSTR_STRING_TABLE_ENTRY(44, 9),
+	FSTR_STRING_TABLE_ENTRY(73, 2),
+	FSTR_STRING_TABLE_ENTRY(75, 5),
+	FSTR_STRING_TABLE_ENTRY(75, 0),
+	FSTR_STRING_TABLE_ENTRY(69, 4));
+
 /**
  * Array
  */
@@ -44,6 +73,9 @@ DEFINE_FSTR_LOCAL(data1, "Test string #1");
 DEFINE_FSTR_LOCAL(data2, "Test string #2");
 DEFINE_FSTR_VECTOR(stringVector, FSTR::String, &data1, nullptr, &data2);
 
+// Generated using `tools/fsindex.py length`
+DEFINE_FSTR_LENGTH_INDEX(stringVectorIndex, 15, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 3, 1, 0, 2);
+
 DEFINE_FSTR_ARRAY_LOCAL(row1, float, 1, 2, 3);
 DEFINE_FSTR_ARRAY_LOCAL(row2, float, 4, 5, 6, 7, 8, 9, 10);
 DEFINE_FSTR_VECTOR(arrayVector, FSTR::Array<float>, &row1, &row2);
@@ -62,7 +94,32 @@ IMPORT_FSTR(FS_content1, COMPONENT_PATH "/files/content1.txt");
 IMPORT_FSTR(FS_content2, COMPONENT_PATH "/files/content2.txt");
 DEFINE_FSTR_MAP(stringMap, FSTR::String, FSTR::String, {&key1, &FS_content1}, {&key2, &FS_content2});
 
+// Generated using `tools/fsindex.py hash`, with and without --ignore-case
+DEFINE_FSTR_HASH_INDEX(stringMapIndex, 0, 1, 1, 0, 0, 1);
+DEFINE_FSTR_HASH_INDEX(stringMapIndexCase, 0, 0, 1, 0, 0, 1);
+
+// As stringMap, but storing a hash with each key
+DEFINE_FSTR_MAP_HASHED(hashedMap, FSTR::String, {&key1, &FS_content1, FSTR_KEY_HASH(key1)},
+					   {&key2, &FS_content2, FSTR_KEY_HASH(key2)});
+
 DEFINE_FSTR_MAP(enumMap, MapKey, FSTR::String, {KeyA, &FS_content1}, {KeyB, &FS_content2});
 
 // Note the use of FSTR_PTR(), required for GCC 4.8.5 because stringVector is a global reference and therefore not constexpr
 DEFINE_FSTR_MAP(vectorMap, FSTR::String, FSTR::Vector<FSTR::String>, {&key1, FSTR_PTR(stringVector)});
+
+// Sorted maps: integral keys are checked at compile time, String keys sorted ignoring case
+
+DEFINE_FSTR_MAP_SORTED(sortedIntMap, int, FSTR::String, {-5, &FS_content1}, {1, &FS_content2}, {7, &FS_content1},
+					   {100, &FS_content2}, {1000, &FS_content1});
+
+DEFINE_FSTR_LOCAL(sortedKey1, "/api/");
+DEFINE_FSTR_LOCAL(sortedKey2, "index.html");
+DEFINE_FSTR_LOCAL(sortedKey3, "Index.js");
+DEFINE_FSTR_LOCAL(sortedKey4, "style.css");
+DEFINE_FSTR_MAP_SORTED(sortedStringMap, FSTR::String, FSTR::String, {&sortedKey1, &FS_content1},
+					   {&sortedKey2, &FS_content2}, {&sortedKey3, &FS_content1}, {&sortedKey4, &FS_content2});
+
+// Generated from sortedStringMap keys using `tools/fsindex.py trie --ignore-case`
+DEFINE_FSTR_TRIE(sortedStringMapTrie, 1, 0, 0, 0, 0, 0, 3, 47, 19, 0, 0, 105, 29, 0, 0, 115, 62, 0, 0, 5, 47, 97, 112, 105,
+				 47, 1, 0, 0, 0, 6, 105, 110, 100, 101, 120, 46, 0, 2, 104, 46, 0, 0, 106, 55, 0, 0, 4, 104, 116, 109,
+				 108, 1, 1, 0, 0, 2, 106, 115, 1, 2, 0, 0, 9, 115, 116, 121, 108, 101, 46, 99, 115, 115, 1, 3, 0, 0);
@@ -22,10 +22,14 @@
 #pragma once
 
 #include <FlashString/String.hpp>
+#include <FlashString/StringTable.hpp>
 #include <FlashString/Array.hpp>
 #include <FlashString/Table.hpp>
 #include <FlashString/Vector.hpp>
 #include <FlashString/Map.hpp>
+#include <FlashString/SortedMap.hpp>
+#include <FlashString/Trie.hpp>
+#include <FlashString/MultiStream.hpp>
 
 /**
  * String
@@ -33,6 +37,8 @@
 
 #define EXTERNAL_FSTR1_TEXT "This is an external flash string\0two\0three\0four"
 DECLARE_FSTR(externalFSTR1);
+DECLARE_FSTR_STRING_TABLE(stringTable);
+DECLARE_FSTR_STRING_TABLE(messageTable);
 
 /**
  * Array
@@ -49,6 +55,7 @@ DECLARE_FSTR_ARRAY(tableArray, TableRow_Float_3);
  */
 
 DECLARE_FSTR_VECTOR(stringVector, FSTR::String);
+DECLARE_FSTR_LENGTH_INDEX(stringVectorIndex);
 DECLARE_FSTR_VECTOR(arrayVector, FSTR::Array<float>);
 
 /**
@@ -63,5 +70,38 @@ enum MapKey : uint8_t {
 
 DECLARE_FSTR_MAP(enumMap, MapKey, FSTR::String);
 DECLARE_FSTR_MAP(stringMap, FSTR::String, FSTR::String);
+DECLARE_FSTR_HASH_INDEX(stringMapIndex);
+DECLARE_FSTR_HASH_INDEX(stringMapIndexCase);
+DECLARE_FSTR_MAP_HASHED(hashedMap, FSTR::String);
 DECLARE_FSTR_MAP(arrayMap, int, FSTR::Array<float>);
 DECLARE_FSTR_MAP(vectorMap, FSTR::String, FSTR::Vector<FSTR::String>);
+
+DECLARE_FSTR_MAP_SORTED(sortedIntMap, int, FSTR::String);
+DECLARE_FSTR_MAP_SORTED(sortedStringMap, FSTR::String, FSTR::String);
+DECLARE_FSTR_TRIE(sortedStringMapTrie);
+
+/**
+ * Test helpers
+ */
+
+// Captures printed output and counts calls to write()
+class PrintCapture : public Print
+{
+public:
+	size_t write(uint8_t c) override
+	{
+		return write(&c, 1);
+	}
+
+	// Buffer may be in flash, so must be read using aligned accesses
+	size_t write(const uint8_t* buffer, size_t size) override
+	{
+		++writeCount;
+		char buf[size];
+		memcpy_P(buf, buffer, size);
+		return content.concat(buf, size) ? size : 0;
+	}
+
+	String content;
+	unsigned writeCount = 0;
+};
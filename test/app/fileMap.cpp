@@ -0,0 +1,38 @@
+// Generated using `tools/fsfiles.py --name fileMap --prefix COMPONENT_PATH --hash --compress --index -o app/fileMap.cpp --data-dir files/filemap files/site`, do not edit
+
+#include "fileMap.h"
+
+IMPORT_FSTR_DATA_WITH_HASH_TYPED(fileMap_content0, COMPONENT_PATH "/files/site/css/style.css", COMPONENT_PATH "/files/filemap/css/style.css.hash", FSTR_IMPORT_TYPE_STRING)
+extern "C" const FSTR::String fileMap_content0;
+IMPORT_FSTR_DATA_WITH_HASH_TYPED(fileMap_content1, COMPONENT_PATH "/files/site/img/logo.svg", COMPONENT_PATH "/files/filemap/img/logo.svg.hash", FSTR_IMPORT_TYPE_STRING)
+extern "C" const FSTR::String fileMap_content1;
+IMPORT_FSTR_DATA_WITH_HASH_TYPED(fileMap_content2, COMPONENT_PATH "/files/site/index.html", COMPONENT_PATH "/files/filemap/index.html.hash", FSTR_IMPORT_TYPE_STRING)
+extern "C" const FSTR::String fileMap_content2;
+IMPORT_FSTR_COMPRESSED(fileMap_compressed2, COMPONENT_PATH "/files/filemap/index.html.fsz")
+IMPORT_FSTR_DATA_WITH_HASH_TYPED(fileMap_content3, COMPONENT_PATH "/files/site/Readme.txt", COMPONENT_PATH "/files/filemap/Readme.txt.hash", FSTR_IMPORT_TYPE_STRING)
+extern "C" const FSTR::String fileMap_content3;
+
+DEFINE_FSTR_LOCAL(fileMap_key0, "css/style.css");
+DEFINE_FSTR_LOCAL(fileMap_key1, "img/logo.svg");
+DEFINE_FSTR_LOCAL(fileMap_key2, "index.html");
+DEFINE_FSTR_LOCAL(fileMap_key3, "Readme.txt");
+
+DEFINE_FSTR_LOCAL(fileMap_mime0, "text/css");
+DEFINE_FSTR_LOCAL(fileMap_mime1, "image/svg+xml");
+DEFINE_FSTR_LOCAL(fileMap_mime2, "text/html");
+DEFINE_FSTR_LOCAL(fileMap_mime3, "text/plain");
+
+DEFINE_FSTR_MAP_SORTED(fileMap, FSTR::String, FSTR::String,
+	{&fileMap_key0, &fileMap_content0},
+	{&fileMap_key1, &fileMap_content1},
+	{&fileMap_key2, &fileMap_content2},
+	{&fileMap_key3, &fileMap_content3});
+
+DEFINE_FSTR_ARRAY(fileMapInfo, FSTR::FileInfo,
+	{&fileMap_mime0, nullptr},
+	{&fileMap_mime1, nullptr},
+	{&fileMap_mime2, &fileMap_compressed2},
+	{&fileMap_mime3, nullptr});
+
+DEFINE_FSTR_HASH_INDEX(fileMapIndex,
+	0, 1, 1, 4, 3, 1, 2, 0);
@@ -0,0 +1,12 @@
+// Generated using `tools/fsfiles.py --name fileMap --prefix COMPONENT_PATH --hash --compress --index -o app/fileMap.cpp --data-dir files/filemap files/site`, do not edit
+
+#pragma once
+
+#include <FlashString/SortedMap.hpp>
+#include <FlashString/Array.hpp>
+#include <FlashString/FileInfo.hpp>
+#include <FlashString/HashIndex.hpp>
+
+DECLARE_FSTR_MAP_SORTED(fileMap, FSTR::String, FSTR::String)
+DECLARE_FSTR_ARRAY(fileMapInfo, FSTR::FileInfo)
+DECLARE_FSTR_HASH_INDEX(fileMapIndex)
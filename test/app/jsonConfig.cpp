@@ -0,0 +1,78 @@
+// Generated using `tools/json2fstr.py --name jsonConfig -o app/jsonConfig.cpp files/config.json`, do not edit
+
+#include "jsonConfig.h"
+
+DEFINE_FSTR_LOCAL(jsonConfig_str0, "name");
+DEFINE_FSTR_LOCAL(jsonConfig_str1, "network");
+DEFINE_FSTR_LOCAL(jsonConfig_str2, "channels");
+DEFINE_FSTR_LOCAL(jsonConfig_str3, "calibration");
+DEFINE_FSTR_LOCAL(jsonConfig_str4, "flags");
+DEFINE_FSTR_LOCAL(jsonConfig_str5, "devices");
+DEFINE_FSTR_LOCAL(jsonConfig_str6, "tags");
+DEFINE_FSTR_LOCAL(jsonConfig_str7, "empty");
+DEFINE_FSTR_LOCAL(jsonConfig_str8, "mixed");
+DEFINE_FSTR_LOCAL(jsonConfig_str9, "Sensor node");
+DEFINE_FSTR_LOCAL(jsonConfig_str10, "ssid");
+DEFINE_FSTR_LOCAL(jsonConfig_str11, "port");
+DEFINE_FSTR_LOCAL(jsonConfig_str12, "dhcp");
+DEFINE_FSTR_LOCAL(jsonConfig_str13, "dns");
+DEFINE_FSTR_LOCAL(jsonConfig_str14, "FlashNet");
+DEFINE_FSTR_LOCAL(jsonConfig_str15, "8080");
+DEFINE_FSTR_LOCAL(jsonConfig_str16, "true");
+DEFINE_FSTR_LOCAL(jsonConfig_str17, "id");
+DEFINE_FSTR_LOCAL(jsonConfig_str18, "label");
+DEFINE_FSTR_LOCAL(jsonConfig_str19, "range");
+DEFINE_FSTR_LOCAL(jsonConfig_str20, "temp");
+DEFINE_FSTR_LOCAL(jsonConfig_str21, "Temperature");
+DEFINE_FSTR_LOCAL(jsonConfig_str22, "hum");
+DEFINE_FSTR_LOCAL(jsonConfig_str23, "Humidity");
+DEFINE_FSTR_LOCAL(jsonConfig_str24, "indoor");
+DEFINE_FSTR_LOCAL(jsonConfig_str25, "");
+DEFINE_FSTR_LOCAL(jsonConfig_str26, "\302\260C");
+DEFINE_FSTR_LOCAL(jsonConfig_str27, "text");
+DEFINE_FSTR_LOCAL(jsonConfig_str28, "42");
+
+DEFINE_FSTR_MAP_LOCAL(jsonConfig_0, FSTR::String, FSTR::String,
+	{&jsonConfig_str10, &jsonConfig_str14},
+	{&jsonConfig_str11, &jsonConfig_str15},
+	{&jsonConfig_str12, &jsonConfig_str16},
+	{&jsonConfig_str13, nullptr});
+DEFINE_FSTR_ARRAY_LOCAL(jsonConfig_1, int32_t, 1, 6, 11);
+DEFINE_FSTR_ARRAY_LOCAL(jsonConfig_2, double, 0.5, -1.25, 3.0);
+DEFINE_FSTR_ARRAY_LOCAL(jsonConfig_3, bool, true, false, true);
+DEFINE_FSTR_ARRAY_LOCAL(jsonConfig_4, int32_t, -40, 125);
+DEFINE_FSTR_MAP_LOCAL(jsonConfig_5, FSTR::String, FSTR::String,
+	{&jsonConfig_str17, &jsonConfig_str20},
+	{&jsonConfig_str18, &jsonConfig_str21},
+	{&jsonConfig_str19, &FSTR_DATA_NAME(jsonConfig_4).object.as<FSTR::String>()});
+DEFINE_FSTR_ARRAY_LOCAL(jsonConfig_6, int32_t, 0, 100);
+DEFINE_FSTR_MAP_LOCAL(jsonConfig_7, FSTR::String, FSTR::String,
+	{&jsonConfig_str17, &jsonConfig_str22},
+	{&jsonConfig_str18, &jsonConfig_str23},
+	{&jsonConfig_str19, &FSTR_DATA_NAME(jsonConfig_6).object.as<FSTR::String>()});
+DEFINE_FSTR_VECTOR_LOCAL(jsonConfig_8, jsonConfig_Map0,
+	&jsonConfig_5,
+	&jsonConfig_7);
+DEFINE_FSTR_VECTOR_LOCAL(jsonConfig_9, FSTR::String,
+	&jsonConfig_str24,
+	&jsonConfig_str9,
+	&jsonConfig_str25,
+	&jsonConfig_str26);
+DEFINE_FSTR_ARRAY_LOCAL(jsonConfig_10, int32_t, 1, 2);
+DEFINE_FSTR_MAP_LOCAL(jsonConfig_11, FSTR::String, FSTR::String,
+	{&jsonConfig_str17, &jsonConfig_str20});
+DEFINE_FSTR_VECTOR_LOCAL(jsonConfig_12, FSTR::String,
+	&jsonConfig_str27,
+	&jsonConfig_str28,
+	&FSTR_DATA_NAME(jsonConfig_10).object.as<FSTR::String>(),
+	&FSTR_DATA_NAME(jsonConfig_11).object.as<FSTR::String>());
+DEFINE_FSTR_MAP(jsonConfig, FSTR::String, FSTR::String,
+	{&jsonConfig_str0, &jsonConfig_str9},
+	{&jsonConfig_str1, &FSTR_DATA_NAME(jsonConfig_0).object.as<FSTR::String>()},
+	{&jsonConfig_str2, &FSTR_DATA_NAME(jsonConfig_1).object.as<FSTR::String>()},
+	{&jsonConfig_str3, &FSTR_DATA_NAME(jsonConfig_2).object.as<FSTR::String>()},
+	{&jsonConfig_str4, &FSTR_DATA_NAME(jsonConfig_3).object.as<FSTR::String>()},
+	{&jsonConfig_str5, &FSTR_DATA_NAME(jsonConfig_8).object.as<FSTR::String>()},
+	{&jsonConfig_str6, &FSTR_DATA_NAME(jsonConfig_9).object.as<FSTR::String>()},
+	{&jsonConfig_str7, nullptr},
+	{&jsonConfig_str8, &FSTR_DATA_NAME(jsonConfig_12).object.as<FSTR::String>()});
@@ -0,0 +1,12 @@
+// Generated using `tools/json2fstr.py --name jsonConfig -o app/jsonConfig.cpp files/config.json`, do not edit
+
+#pragma once
+
+#include <FlashString/Map.hpp>
+#include <FlashString/Vector.hpp>
+#include <FlashString/Array.hpp>
+
+// $.network
+using jsonConfig_Map0 = FSTR::Map<FSTR::String, FSTR::String>;
+
+extern const jsonConfig_Map0& jsonConfig;
@@ -21,6 +21,47 @@
 
 #include <SmingTest.h>
 #include "data.h"
+#include "fileMap.h"
+#include "jsonConfig.h"
+
+namespace
+{
+/*
+ * Walk an object graph using only the type information stored with each object
+ */
+size_t getTotalSize(const FSTR::ObjectBase& object, unsigned& count)
+{
+	++count;
+	size_t total = sizeof(uint32_t) + object.size();
+	auto length = object.length();
+	auto data = object.data();
+	auto elementSize = object.elementSize();
+	const FSTR::ObjectBase* ptr;
+	switch(object.type()) {
+	case FSTR::Type::Vector:
+		for(unsigned offset = 0; offset < length; offset += elementSize) {
+			memcpy_P(&ptr, data + offset, sizeof(ptr));
+			if(ptr != nullptr) {
+				total += getTotalSize(*ptr, count);
+			}
+		}
+		break;
+	case FSTR::Type::Map:
+		for(unsigned offset = 0; offset < length; offset += elementSize) {
+			memcpy_P(&ptr, data + offset, sizeof(ptr));
+			total += getTotalSize(*ptr, count);
+			memcpy_P(&ptr, data + offset + elementSize / 2, sizeof(ptr));
+			if(ptr != nullptr) {
+				total += getTotalSize(*ptr, count);
+			}
+		}
+		break;
+	default:;
+	}
+	return total;
+}
+
+} // namespace
 
 class MapTest : public TestGroup
 {
@@ -62,6 +103,29 @@ public:
 				REQUIRE(!stringMap["key20"]);
 				REQUIRE(stringMap["key20"].content().isNull());
 			}
+
+			TEST_CASE("hash lookup")
+			{
+				REQUIRE(stringMap.indexOf("key1", stringMapIndex) == 0);
+				REQUIRE(stringMap.indexOf("KEY2", stringMapIndex) == 1);
+				REQUIRE(stringMap.indexOf("key20", stringMapIndex) == -1);
+				REQUIRE(stringMap.indexOf(String("key2"), stringMapIndexCase) == 1);
+				REQUIRE(stringMap.indexOf("KEY2", stringMapIndexCase) == -1);
+			}
+		}
+
+		TEST_CASE("Map of String => String with hashed keys")
+		{
+			hashedMap.printTo(Serial);
+			Serial.println();
+
+			REQUIRE(hashedMap.valueAt(0).keyHash() == FSTR::Hash::calculate("KEY1", 4, true));
+			REQUIRE(hashedMap.indexOf("key1") == 0);
+			REQUIRE(hashedMap.indexOf("KEY2") == 1);
+			REQUIRE(hashedMap.indexOf("KEY2", false) == -1);
+			REQUIRE(hashedMap.indexOf(String("key2"), false) == 1);
+			REQUIRE(hashedMap.indexOf("key20") == -1);
+			REQUIRE(hashedMap["key1"].content() == stringMap["key1"].content());
 		}
 
 		TEST_CASE("Map[0] as Array<int64>")
@@ -75,6 +139,21 @@ public:
 			//		FSTR::println(Serial, arr);
 		}
 
+		TEST_CASE("Print")
+		{
+			PrintCapture capture;
+			FSTR::Map<int, FSTR::Array<float>> emptyMap;
+			emptyMap.printTo(capture);
+			REQUIRE(capture.content == F("{\r\n}"));
+
+			capture.content = nullptr;
+			arrayMap.printTo(capture);
+			REQUIRE(capture.content == F("{\r\n"
+										 "  1 => [1.00, 2.00, 3.00]\r\n"
+										 "  2 => [4.00, 5.00, 6.00, 7.00, 8.00, 9.00, 10.00]\r\n"
+										 "}"));
+		}
+
 		TEST_CASE("Map of enum MapKey => String")
 		{
 			Serial.printf(_F("enumMap[%u]\n"), enumMap.length());
@@ -126,6 +205,137 @@ public:
 				printTableMapEntry("key2");
 			}
 		}
+
+		TEST_CASE("SortedMap of int => String")
+		{
+			REQUIRE(sortedIntMap.isSorted());
+			REQUIRE(sortedIntMap.indexOf(-5) == 0);
+			REQUIRE(sortedIntMap.indexOf(100) == 3);
+			REQUIRE(sortedIntMap.indexOf(1000) == 4);
+			REQUIRE(sortedIntMap.indexOf(0) == -1);
+			REQUIRE(sortedIntMap.indexOf(2000) == -1);
+			REQUIRE(sortedIntMap[7]);
+			REQUIRE(!sortedIntMap[8]);
+		}
+
+		TEST_CASE("SortedMap of String => String")
+		{
+			sortedStringMap.printTo(Serial);
+			Serial.println();
+
+			REQUIRE(sortedStringMap.isSorted());
+			REQUIRE(sortedStringMap.indexOf("/api/") == 0);
+			REQUIRE(sortedStringMap.indexOf("INDEX.HTML") == 1);
+			REQUIRE(sortedStringMap.indexOf("index.js") == 2);
+			REQUIRE(sortedStringMap.indexOf("index.js", false) == -1);
+			REQUIRE(sortedStringMap.indexOf("Index.js", false) == 2);
+			REQUIRE(sortedStringMap.indexOf(String("style.css")) == 3);
+			REQUIRE(sortedStringMap.indexOf("index") == -1);
+			REQUIRE(sortedStringMap["/API/"]);
+			REQUIRE(!sortedStringMap["zzz"]);
+		}
+
+		TEST_CASE("Trie prefix matching")
+		{
+			auto& trie = sortedStringMapTrie;
+			REQUIRE(trie.ignoreCase());
+
+			size_t matchLength{0};
+			REQUIRE(trie.longestPrefix("/api/v1/users", &matchLength) == 0);
+			REQUIRE(matchLength == 5);
+			REQUIRE(trie.longestPrefix("Index.JS") == 2);
+			REQUIRE(trie.longestPrefix("index.htm") == -1);
+			REQUIRE(trie.longestPrefix(String("style.css?v=2")) == 3);
+
+			REQUIRE(trie.startsWith("IND") == 1);
+			REQUIRE(trie.startsWith("s") == 3);
+			REQUIRE(trie.startsWith("x") == -1);
+
+			int i = trie.longestPrefix("/api/v1/users");
+			REQUIRE(sortedStringMap.valueAt(i).key() == "/api/");
+		}
+
+		// Generated from files/site using `tools/fsfiles.py`, see fileMap.cpp for command line
+		TEST_CASE("File map")
+		{
+			REQUIRE(fileMap.length() == 4);
+			REQUIRE(fileMapInfo.length() == 4);
+			REQUIRE(fileMap.isSorted());
+
+			int i = fileMap.indexOf("index.html");
+			REQUIRE(i >= 0);
+			REQUIRE(fileMap.indexOf("INDEX.HTML", fileMapIndex) == i);
+			REQUIRE(fileMap.indexOf("missing.html", fileMapIndex) == -1);
+
+			auto file = fileMap.valueAt(i);
+			auto info = fileMapInfo[i];
+			REQUIRE(info.mimeType() == "text/html");
+			REQUIRE(file.content().length() == 1677);
+			REQUIRE(file.content().contentHash().crc32 == 0xab4a7891);
+			REQUIRE(!info.compressed().isNull());
+			REQUIRE(info.compressed().originalLength() == file.content().length());
+
+			i = fileMap.indexOf("css/style.css");
+			REQUIRE(fileMapInfo[i].mimeType() == "text/css");
+			REQUIRE(fileMapInfo[i].compressed().isNull());
+		}
+
+		TEST_CASE("JSON document")
+		{
+			REQUIRE(jsonConfig.length() == 9);
+			REQUIRE(jsonConfig["name"].content() == "Sensor node");
+
+			auto& network = jsonConfig["network"].content().as<jsonConfig_Map0>();
+			REQUIRE(network["port"].content() == "8080");
+			REQUIRE(network["dhcp"].content() == "true");
+			REQUIRE(network.indexOf("dns") >= 0);
+			REQUIRE(network["dns"].content().isNull());
+
+			auto& channels = jsonConfig["channels"].content().as<FSTR::Array<int32_t>>();
+			REQUIRE(channels.length() == 3);
+			REQUIRE(channels[2] == 11);
+
+			auto& devices = jsonConfig["devices"].content().as<FSTR::Vector<jsonConfig_Map0>>();
+			REQUIRE(devices.length() == 2);
+			REQUIRE(devices[1]["label"].content() == "Humidity");
+			auto& range = devices[0]["range"].content().as<FSTR::Array<int32_t>>();
+			REQUIRE(range[0] == -40);
+
+			// Identical strings are shared
+			auto& tags = jsonConfig["tags"].content().as<FSTR::Vector<FSTR::String>>();
+			REQUIRE(&tags[1] == &jsonConfig["name"].content());
+
+			REQUIRE(jsonConfig["empty"].content().isNull());
+		}
+
+		TEST_CASE("Type information")
+		{
+			auto& base = static_cast<const FSTR::ObjectBase&>(jsonConfig);
+			REQUIRE(base.type() == FSTR::Type::Map);
+			REQUIRE(base.elementSize() == jsonConfig.elementSize());
+			REQUIRE(jsonConfig["name"].content().type() == FSTR::Type::String);
+			REQUIRE(jsonConfig["channels"].content().type() == FSTR::Type::Signed);
+			REQUIRE(jsonConfig["calibration"].content().type() == FSTR::Type::Float);
+			REQUIRE(jsonConfig["flags"].content().type() == FSTR::Type::Bool);
+			REQUIRE(jsonConfig["devices"].content().type() == FSTR::Type::Vector);
+			REQUIRE(jsonConfig["empty"].content().type() == FSTR::Type::Unknown);
+
+			REQUIRE(stringMap["key1"].content().type() == FSTR::Type::String);
+			REQUIRE(enumMap.type() == FSTR::Type::IntegerMap);
+			REQUIRE(hashedMap.type() == FSTR::Type::HashedMap);
+			REQUIRE(tableArray.type() == FSTR::Type::Struct);
+			REQUIRE(static_cast<const FSTR::ObjectBase&>(tableArray).elementSize() == sizeof(TableRow_Float_3));
+
+			// Copies and slices report the type of the real object
+			FSTR::String copy(jsonConfig["name"].content());
+			REQUIRE(copy.type() == FSTR::Type::String);
+			REQUIRE(copy.substring(1, 2).type() == FSTR::Type::String);
+
+			unsigned count = 0;
+			auto size = getTotalSize(jsonConfig, count);
+			Serial.printf(_F("jsonConfig contains %u objects, %u bytes\n"), count, size);
+			REQUIRE(count == 49);
+		}
 	}
 };
 
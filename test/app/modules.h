@@ -5,4 +5,6 @@
 	XX(array)                                                                                                          \
 	XX(vector)                                                                                                         \
 	XX(map)                                                                                                            \
-	XX(custom)
+	XX(custom)                                                                                                         \
+	XX(compressed)                                                                                                     \
+	XX(variant)
@@ -21,6 +21,19 @@
 
 #include <SmingTest.h>
 #include "data.h"
+#include <FlashString/IndexedTemplateStream.hpp>
+#include <FlashString/Stream.hpp>
+
+IMPORT_FSTR(templateContent, COMPONENT_PATH "/files/template.html");
+// Hash file generated using `tools/fshash.py content2.txt`
+IMPORT_FSTR_HASHED(hashedContent, COMPONENT_PATH "/files/content2.txt");
+// Paired with the hash of other content, as if the hash file had not been regenerated
+IMPORT_FSTR_DATA_WITH_HASH_TYPED(staleContent, COMPONENT_PATH "/files/template.html",
+								 COMPONENT_PATH "/files/content2.txt.hash", FSTR_IMPORT_TYPE_STRING)
+extern "C" const FSTR::String staleContent;
+
+// Generated using `tools/fsindex.py template`
+DEFINE_FSTR_TEMPLATE_INDEX_LOCAL(templateIndex, 13, 83951623, 35, 134283274, 47, 67174406, 55, 117506057);
 
 class StringTest : public TestGroup
 {
@@ -174,6 +187,191 @@ public:
 			REQUIRE(String(demoFSTR1) == demoFSTR2);
 			REQUIRE(demoFSTR1 == String(demoFSTR2));
 		}
+
+		TEST_CASE("Compare")
+		{
+			FSTR_ARRAY(text, DEMO_TEST_TEXT);
+			auto len = demoFSTR1.length();
+			// Check unaligned RAM buffers and lengths which aren't a multiple of 4
+			for(unsigned offset = 0; offset < 4; ++offset) {
+				char buf[sizeof(text) + 4];
+				auto s = buf + offset;
+				memcpy(s, text, len);
+				REQUIRE(demoFSTR1.equals(s, len));
+				REQUIRE(demoFSTR1.equalsIgnoreCase(s, len));
+				REQUIRE(!demoFSTR1.equals(s, len - 1));
+				s[len - 1] ^= 0x01;
+				REQUIRE(!demoFSTR1.equals(s, len));
+				REQUIRE(!demoFSTR1.equalsIgnoreCase(s, len));
+			}
+
+			String upper = demoFSTR1;
+			upper.toUpperCase();
+			REQUIRE(!demoFSTR1.equals(upper));
+			REQUIRE(demoFSTR1.equalsIgnoreCase(upper));
+			// Characters either side of the alphabetic ranges are not letters
+			DEFINE_FSTR_LOCAL(punctuation, "@[`{");
+			REQUIRE(punctuation.equalsIgnoreCase("@[`{"));
+			REQUIRE(!punctuation.equalsIgnoreCase("`{@["));
+		}
+
+		TEST_CASE("Search")
+		{
+			REQUIRE(demoFSTR1.indexOf("flash") == 10);
+			REQUIRE(demoFSTR1.indexOf("flash", 11) == -1);
+			REQUIRE(demoFSTR1.indexOf(" -", 0) == 22);
+			REQUIRE(demoFSTR1.indexOf(" -", 23) == 31);
+			REQUIRE(demoFSTR1.lastIndexOf(" -") == 39);
+			REQUIRE(demoFSTR1.lastIndexOf(" -", 38) == 31);
+			REQUIRE(demoFSTR1.indexOf("-\0Third", sizeof("-\0Third") - 1, 0) == 32);
+			REQUIRE(demoFSTR1.indexOf(String(F("Fourth"))) == 42);
+			REQUIRE(demoFSTR1.indexOf('\0') == 24);
+			REQUIRE(demoFSTR1.contains("Third"));
+			REQUIRE(!demoFSTR1.contains("Fifth"));
+			REQUIRE(demoFSTR1.startsWith("This is"));
+			REQUIRE(!demoFSTR1.startsWith("is"));
+			REQUIRE(demoFSTR1.endsWith(FS("Fourth.")));
+			REQUIRE(!demoFSTR1.endsWith("Fourth"));
+
+			// Matches spanning read chunks
+#define DIGITS "0123456789"
+			DEFINE_FSTR_LOCAL(longText, DIGITS DIGITS DIGITS DIGITS DIGITS DIGITS "needle in a haystack" DIGITS DIGITS);
+			REQUIRE(longText.indexOf("needle in a haystack") == 60);
+			REQUIRE(longText.lastIndexOf("needle in a haystack") == 60);
+			REQUIRE(longText.indexOf("89n") == 58);
+			REQUIRE(longText.lastIndexOf(DIGITS) == 90);
+			REQUIRE(longText.lastIndexOf(DIGITS, 89) == 80);
+			REQUIRE(longText.endsWith("haystack" DIGITS DIGITS));
+			REQUIRE(longText.indexOf(String(longText)) == 0);
+		}
+
+		TEST_CASE("Substring")
+		{
+			auto flash = demoFSTR1.substring(10, 5);
+			REQUIRE(flash.length() == 5);
+			REQUIRE(flash == "flash");
+			REQUIRE(String(flash) == F("flash"));
+			REQUIRE(demoFSTR1.substring(42) == "Fourth.");
+			REQUIRE(demoFSTR1.substring(100).length() == 0);
+			REQUIRE(flash.substring(1, 3) == "las");
+
+			// Slices may share a start position but differ in length
+			REQUIRE(demoFSTR1.substring(0, 4) != demoFSTR1.substring(0, 7));
+			// Content at different alignments
+			REQUIRE(demoFSTR1.substring(2, 2) == demoFSTR1.substring(5, 2));
+			REQUIRE(demoFSTR1.substring(1, 40) == demoFSTR2.substring(1, 40));
+
+			LOAD_FSTR(buf, flash);
+			REQUIRE(strcmp(buf, "flash") == 0);
+
+			FSTR::Stream stream(demoFSTR1.substring(25, 6));
+			char data[16];
+			auto len = stream.readMemoryBlock(data, sizeof(data));
+			REQUIRE(len == 6);
+			REQUIRE(memcmp(data, "Second", 6) == 0);
+		}
+
+		TEST_CASE("String table")
+		{
+			REQUIRE(stringTable.count() == 6);
+			REQUIRE(stringTable[0] == "Temperature");
+			REQUIRE(stringTable[2] == "A");
+			REQUIRE(stringTable[3].length() == 0);
+			REQUIRE(!stringTable[3].isNull());
+			REQUIRE(stringTable.stringLength(4) == 10);
+			REQUIRE(String(stringTable[5]) == F("Pressure"));
+			REQUIRE(stringTable[6].isNull());
+
+			REQUIRE(stringTable.indexOf("Wind speed") == 4);
+			REQUIRE(stringTable.indexOf("") == 3);
+			REQUIRE(stringTable.indexOf("humidity") == -1);
+			REQUIRE(stringTable.indexOf("humidity", true) == 1);
+			REQUIRE(stringTable.indexOf(String("Pressure")) == 5);
+
+			// Content is 38 characters, plus a 2-byte index entry per string and one more per table
+			REQUIRE(stringTable.length() == 38 + 2 * 7);
+			REQUIRE(!stringTable.isMerged());
+		}
+
+		TEST_CASE("Merged string table")
+		{
+			REQUIRE(messageTable.isMerged());
+			REQUIRE(messageTable.count() == 10);
+			REQUIRE(messageTable[1] == "WriteError");
+			REQUIRE(messageTable[2] == "Error");
+			REQUIRE(messageTable[4] == ".html");
+			REQUIRE(messageTable[8].length() == 0);
+			REQUIRE(messageTable.stringLength(9) == 4);
+			REQUIRE(messageTable[10].isNull());
+
+			// Duplicates and tails share content
+			REQUIRE(messageTable[5].data() == messageTable[0].data());
+			REQUIRE(messageTable[5] == messageTable[0]);
+			REQUIRE(messageTable[2].data() == messageTable[0].substring(4).data());
+			REQUIRE(messageTable[9].data() == messageTable[3].substring(6).data());
+
+			REQUIRE(messageTable.indexOf("Error") == 2);
+			REQUIRE(messageTable.indexOf("error") == 7);
+			REQUIRE(messageTable.indexOf("ERROR", true) == 2);
+			REQUIRE(messageTable.indexOf("") == 8);
+			REQUIRE(messageTable.indexOf("Warning") == -1);
+		}
+
+		TEST_CASE("Indexed template")
+		{
+			REQUIRE(templateIndex.count() == 4);
+			auto tag = templateIndex.getTag(1);
+			REQUIRE(tag.offset == 35);
+			REQUIRE(tag.length == 10);
+			REQUIRE(tag.nameOffset == 1);
+			REQUIRE(tag.nameLength == 8);
+
+			FSTR::IndexedTemplateStream stream(templateContent, templateIndex);
+			stream.setVar("title", "Test");
+			stream.setVar("greeting", "Hello");
+			stream.setVar("name", "");
+			String s;
+			char buf[16];
+			while(!stream.isFinished()) {
+				auto len = stream.readMemoryBlock(buf, sizeof(buf));
+				REQUIRE(len != 0);
+				s.concat(buf, len);
+				stream.seek(len);
+			}
+			REQUIRE(s == F("<html><title>Test</title>\n<body>Hello, ! {unknown} {bad tag}</body></html>\n"));
+		}
+
+		TEST_CASE("Print")
+		{
+			PrintCapture chunked;
+			REQUIRE(demoFSTR1.printer(16, 0).printTo(chunked) == demoFSTR1.length());
+			REQUIRE(demoFSTR1 == chunked.content);
+			REQUIRE(chunked.writeCount == 4);
+
+			PrintCapture direct;
+			REQUIRE(demoFSTR1.printer(FSTR::StringPrinter::directWrite).printTo(direct) == demoFSTR1.length());
+			REQUIRE(demoFSTR1 == direct.content);
+			REQUIRE(direct.writeCount == 1);
+		}
+
+		TEST_CASE("Content hash")
+		{
+			REQUIRE(hashedContent.length() == 41);
+			REQUIRE(hashedContent.startsWith("This is content"));
+
+			auto hash = hashedContent.contentHash();
+			REQUIRE(hash.hasCrc32());
+			REQUIRE(hash.hasSha256());
+			REQUIRE(hash.crc32 == 0xbb5bcb13);
+			REQUIRE(hash.sha256[0] == 0xfc);
+
+			FSTR::String copy(hashedContent);
+			REQUIRE(copy.contentHash().crc32 == hash.crc32);
+			REQUIRE(hashedContent.substring(1).contentHash().flags == 0);
+			REQUIRE(demoFSTR1.contentHash().flags == 0);
+			REQUIRE(staleContent.length() == templateContent.length());
+			REQUIRE(staleContent.contentHash().flags == 0);
+		}
 	}
 };
 
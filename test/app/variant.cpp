@@ -0,0 +1,118 @@
+/**
+ * variant.cpp - Variant tests
+ *
+ * Copyright 2019 mikee47 <mike@sillyhouse.net>
+ *
+ * This file is part of the FlashString Library
+ *
+ * This library is free software: you can redistribute it and/or modify it under the terms of the
+ * GNU General Public License as published by the Free Software Foundation, version 3 or later.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with FlashString.
+ * If not, see <https://www.gnu.org/licenses/>.
+ *
+ ****/
+
+#include <SmingTest.h>
+#include <FlashString/Variant.hpp>
+#include "data.h"
+#include "jsonConfig.h"
+
+class VariantTest : public TestGroup
+{
+public:
+	VariantTest() : TestGroup(_F("Variant"))
+	{
+	}
+
+	void execute() override
+	{
+		FSTR::Variant doc(jsonConfig);
+
+		TEST_CASE("Map lookup")
+		{
+			REQUIRE(doc.isMap());
+			REQUIRE(doc.length() == jsonConfig.length());
+			REQUIRE(doc["name"] == "Sensor node");
+			REQUIRE(doc["name"].key() == "name");
+			REQUIRE(doc["NETWORK"]["ssid"] == "FlashNet");
+			REQUIRE(doc["network"]["dns"].isNull());
+			REQUIRE(!doc["missing"]["name"][3]);
+		}
+
+		TEST_CASE("Arrays")
+		{
+			auto channels = doc["channels"];
+			REQUIRE(channels.isArray());
+			REQUIRE(channels.length() == 3);
+			REQUIRE(channels.asArray<int32_t>()[1] == 6);
+			REQUIRE(channels.asArray<uint8_t>().isNull());
+			REQUIRE(doc["calibration"].asArray<double>()[1] == -1.25);
+			Serial.print(_F("channels: "));
+			FSTR::println(Serial, channels);
+		}
+
+		TEST_CASE("Vectors")
+		{
+			auto devices = doc["devices"];
+			REQUIRE(devices.isVector());
+			REQUIRE(devices[1]["label"] == "Humidity");
+			REQUIRE(devices[0]["range"].asArray<int32_t>()[0] == -40);
+			REQUIRE(doc["mixed"][3]["id"] == "temp");
+		}
+
+		TEST_CASE("Iteration")
+		{
+			unsigned count = 0;
+			for(auto device : doc["devices"]) {
+				REQUIRE(device.isMap());
+				++count;
+			}
+			REQUIRE(count == 2);
+
+			count = 0;
+			for(auto entry : doc) {
+				FSTR::print(Serial, entry.key());
+				Serial.print(_F(": "));
+				FSTR::println(Serial, entry);
+				++count;
+			}
+			REQUIRE(count == jsonConfig.length());
+		}
+
+		TEST_CASE("Other maps")
+		{
+			FSTR::Variant hashed(hashedMap);
+			REQUIRE(hashed.type() == FSTR::Type::HashedMap);
+			REQUIRE(hashed["KEY1"].asString() == hashedMap["key1"].content());
+
+			FSTR::Variant intMap(enumMap);
+			REQUIRE(intMap.type() == FSTR::Type::IntegerMap);
+			REQUIRE(intMap[1].asString() == enumMap.valueAt(1).content());
+			REQUIRE(intMap["key"].isNull());
+		}
+
+		TEST_CASE("String table")
+		{
+			// Table content is not interpreted
+			FSTR::Variant table(stringTable);
+			REQUIRE(table.type() == FSTR::Type::StringTable);
+			REQUIRE(table.length() == 0);
+			REQUIRE(table[0].isNull());
+
+			auto str = stringTable[0];
+			FSTR::Variant slice(str);
+			REQUIRE(slice.type() == FSTR::Type::StringTable);
+			REQUIRE(!slice.isString());
+		}
+	}
+};
+
+void REGISTER_TEST(variant)
+{
+	registerGroup<VariantTest>();
+}
@@ -77,6 +77,39 @@ public:
 				i = stringVector.indexOf(String::empty);
 				REQUIRE(i == 1);
 			}
+
+			TEST_CASE("indexed lookup")
+			{
+				int i = stringVector.indexOf(_F("Test string #2"), stringVectorIndex);
+				REQUIRE(i == 2);
+				i = stringVector.indexOf(_F("Test STRING #2"), stringVectorIndex, false);
+				REQUIRE(i == -1);
+				i = stringVector.indexOf(_F("Test STRING #1"), stringVectorIndex);
+				REQUIRE(i == 0);
+				i = stringVector.indexOf(_F("Test string #"), stringVectorIndex);
+				REQUIRE(i == -1);
+				i = stringVector.indexOf(nullptr, stringVectorIndex);
+				REQUIRE(i == 1);
+				i = stringVector.indexOf(String::empty, stringVectorIndex);
+				REQUIRE(i == 1);
+			}
+
+			TEST_CASE("MultiStream")
+			{
+				FSTR::MultiStream stream(stringVector);
+				REQUIRE(stream.available() == 28);
+				char buf[32];
+				auto len = stream.readMemoryBlock(buf, sizeof(buf));
+				REQUIRE(len == 28);
+				REQUIRE(memcmp(buf, "Test string #1Test string #2", len) == 0);
+				REQUIRE(stream.seekFrom(12, SEEK_SET) == 12);
+				len = stream.readMemoryBlock(buf, 4);
+				REQUIRE(len == 4);
+				REQUIRE(memcmp(buf, "#1Te", len) == 0);
+				REQUIRE(stream.seekFrom(-2, SEEK_END) == 26);
+				REQUIRE(stream.readMemoryBlock(buf, sizeof(buf)) == 2);
+				REQUIRE(stream.seekFrom(1, SEEK_END) < 0);
+			}
 		}
 	}
 };
@@ -0,0 +1,91 @@
+#!/usr/bin/env python3
+#
+# fscompress.py - Compress a file for use with IMPORT_FSTR_COMPRESSED
+#
+# Copyright 2019 mikee47 <mike@sillyhouse.net>
+#
+# This file is part of the FlashString Library
+#
+# This library is free software: you can redistribute it and/or modify it under the terms of the
+# GNU General Public License as published by the Free Software Foundation, version 3 or later.
+#
+# This library is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+# without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+# See the GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License along with FlashString.
+# If not, see <https://www.gnu.org/licenses/>.
+#
+# Output is an image as described in CompressedObject.hpp: a header, an optional block offset table,
+# then a gzip stream. The window size determines how much RAM is needed for decompression.
+#
+# With a block size, each block is compressed independently (using a full flush) so that
+# decompression can start at any block. This gives fast random access at some cost in compression.
+#
+# Example:
+#
+#   fscompress.py --window-bits 11 files/index.html files/index.html.fsz
+#   fscompress.py --block-size 4096 files/table.bin files/table.bin.fsz
+#
+
+import argparse
+import struct
+import zlib
+
+MAGIC = 0x5a545346  # 'FSTZ'
+ENCODING_GZIP = 1
+HEADER_FORMAT = '<IIBBHI'
+GZIP_HEADER = bytes([0x1f, 0x8b, 8, 0, 0, 0, 0, 0, 0, 0xff])
+
+
+def compress(data, window_bits, level, block_size):
+    """Produce a gzip stream, must use a fixed 10-byte header as expected by CompressedObject.
+
+    Returns the stream and a list of block offsets relative to the start of the deflate data.
+    """
+    c = zlib.compressobj(level, zlib.DEFLATED, -window_bits, 9)
+    deflated = b''
+    offsets = []
+    if block_size:
+        for pos in range(0, len(data), block_size):
+            offsets.append(len(deflated))
+            deflated += c.compress(data[pos:pos + block_size])
+            if pos + block_size < len(data):
+                deflated += c.flush(zlib.Z_FULL_FLUSH)
+    else:
+        deflated += c.compress(data)
+    deflated += c.flush()
+    trailer = struct.pack('<II', zlib.crc32(data) & 0xffffffff, len(data) & 0xffffffff)
+    return GZIP_HEADER + deflated + trailer, offsets
+
+
+def create_image(data, window_bits, level, block_size):
+    header = struct.pack(HEADER_FORMAT, MAGIC, len(data), ENCODING_GZIP, window_bits, 0, block_size)
+    gzip, offsets = compress(data, window_bits, level, block_size)
+    table = struct.pack('<%uI' % len(offsets), *offsets)
+    return header + table + gzip
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Compress a file for use with IMPORT_FSTR_COMPRESSED')
+    parser.add_argument('--window-bits', type=int, default=11, choices=range(9, 16), metavar='[9-15]',
+                        help='Size of decompression window as a power of 2 (default: 11, 2048 bytes)')
+    parser.add_argument('--level', type=int, default=9, choices=range(0, 10), metavar='[0-9]',
+                        help='Compression level (default: 9)')
+    parser.add_argument('--block-size', type=int, default=0,
+                        help='Compress in blocks of this size to allow random access (default: 0, no blocks)')
+    parser.add_argument('input', help='File to compress')
+    parser.add_argument('output', help='Output image file')
+    args = parser.parse_args()
+    if args.block_size < 0:
+        parser.error('Block size cannot be negative')
+
+    with open(args.input, 'rb') as f:
+        data = f.read()
+    image = create_image(data, args.window_bits, args.level, args.block_size)
+    with open(args.output, 'wb') as f:
+        f.write(image)
+
+
+if __name__ == '__main__':
+    main()
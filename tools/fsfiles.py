@@ -0,0 +1,235 @@
+#!/usr/bin/env python3
+#
+# fsfiles.py - Generate a file map from a directory tree
+#
+# Copyright 2019 mikee47 <mike@sillyhouse.net>
+#
+# This file is part of the FlashString Library
+#
+# This library is free software: you can redistribute it and/or modify it under the terms of the
+# GNU General Public License as published by the Free Software Foundation, version 3 or later.
+#
+# This library is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+# without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+# See the GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License along with FlashString.
+# If not, see <https://www.gnu.org/licenses/>.
+#
+# Output is a C++ source file and matching header defining:
+#
+#   NAME        SortedMap<String, String> of relative path => file content
+#   NAMEInfo    Array<FileInfo> with MIME type and compressed content for each entry, in the same order
+#   NAMEIndex   Optional perfect hash table for lookups (--index)
+#
+# Hash (--hash) and compressed (--compress) files are written to the data directory.
+# Files with identical content are imported once, and their entries refer to the same objects.
+# MIME types are determined from the file extension only, so output is the same on any host.
+# Paths in the output are absolute, unless --prefix is given in which case they are relative
+# to the current directory and prefixed with the given macro.
+#
+# Example, run from the project directory:
+#
+#   fsfiles.py --name fileMap --prefix PROJECT_DIR --hash --compress --index -o app/fileMap.cpp files/web
+#
+
+import argparse
+import mimetypes
+import os
+import sys
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+import fscompress
+import fshash
+import fsindex
+
+# Compressed content is only stored if it saves at least this fraction of the original size
+MIN_SAVING = 0.1
+
+# Common web content. These take precedence so that output does not depend on the Python version.
+MIME_TYPES = {
+    '.css': 'text/css',
+    '.gif': 'image/gif',
+    '.htm': 'text/html',
+    '.html': 'text/html',
+    '.ico': 'image/x-icon',
+    '.jpeg': 'image/jpeg',
+    '.jpg': 'image/jpeg',
+    '.js': 'application/javascript',
+    '.json': 'application/json',
+    '.png': 'image/png',
+    '.svg': 'image/svg+xml',
+    '.txt': 'text/plain',
+    '.wasm': 'application/wasm',
+    '.webp': 'image/webp',
+    '.woff': 'font/woff',
+    '.woff2': 'font/woff2',
+    '.xml': 'text/xml',
+}
+
+# Python's own table, without system files such as /etc/mime.types which vary between hosts
+mime_db = mimetypes.MimeTypes()
+
+
+def fold_case(key):
+    return bytes(fsindex.fold_case(c) for c in key)
+
+
+def scan(root):
+    """Return list of (key, filename) for all files under root, sorted by key ignoring case."""
+    files = []
+    for dirpath, dirnames, filenames in os.walk(root):
+        dirnames.sort()
+        for f in filenames:
+            filename = os.path.join(dirpath, f)
+            key = os.path.relpath(filename, root).replace(os.sep, '/')
+            files.append((key.encode(), filename))
+    files.sort(key=lambda f: fold_case(f[0]))
+    folded = [fold_case(key) for key, _ in files]
+    if len(set(folded)) != len(folded):
+        raise ValueError('File names must be unique ignoring case')
+    return files
+
+
+class Generator:
+    def __init__(self, args):
+        self.args = args
+        self.imports = []
+        self.definitions = []
+        self.mime_definitions = []
+        self.mime_types = {}
+        self.contents = {}
+
+    def path(self, filename):
+        """Path as used in the output."""
+        if any(c in filename for c in '"\\'):
+            raise ValueError('Unsupported file name %r' % filename)
+        if self.args.prefix is None:
+            return '"%s"' % os.path.abspath(filename)
+        return '%s "/%s"' % (self.args.prefix, os.path.relpath(filename).replace(os.sep, '/'))
+
+    def data_file(self, key, ext):
+        filename = os.path.join(self.args.data_dir, key.decode()) + ext
+        os.makedirs(os.path.dirname(filename), exist_ok=True)
+        return filename
+
+    def mime_type(self, key):
+        path = key.decode()
+        mime = MIME_TYPES.get(os.path.splitext(path)[1].lower())
+        if mime is None:
+            mime, _ = mime_db.guess_type(path, strict=False)
+        mime = (mime or self.args.default_mime).encode()
+        name = self.mime_types.get(mime)
+        if name is None:
+            name = '%s_mime%u' % (self.args.name, len(self.mime_types))
+            self.mime_types[mime] = name
+            self.mime_definitions.append('DEFINE_FSTR_LOCAL(%s, %s);' % (name, fsindex.c_string(mime)))
+        return name
+
+    def content(self, i, key, filename):
+        """Import content of a file, returning names of objects for the content and its compressed form.
+
+        Files with identical content share the same objects.
+        """
+        with open(filename, 'rb') as f:
+            data = f.read()
+        objects = self.contents.get(data)
+        if objects is not None:
+            return objects
+        name = '%s_content%u' % (self.args.name, i)
+        if self.args.hash:
+            hash_file = self.data_file(key, '.hash')
+            with open(hash_file, 'wb') as f:
+                f.write(fshash.create_hash(data, True, True))
+            self.imports.append('IMPORT_FSTR_DATA_WITH_HASH_TYPED(%s, %s, %s, FSTR_IMPORT_TYPE_STRING)' %
+                                (name, self.path(filename), self.path(hash_file)))
+            self.imports.append('extern "C" const FSTR::String %s;' % name)
+        else:
+            self.imports.append('IMPORT_FSTR(%s, %s)' % (name, self.path(filename)))
+        objects = name, self.compressed(i, key, data)
+        self.contents[data] = objects
+        return objects
+
+    def compressed(self, i, key, data):
+        if not self.args.compress or len(data) == 0:
+            return 'nullptr'
+        image = fscompress.create_image(data, self.args.window_bits, 9, 0)
+        if len(image) > len(data) * (1 - MIN_SAVING):
+            return 'nullptr'
+        filename = self.data_file(key, '.fsz')
+        with open(filename, 'wb') as f:
+            f.write(image)
+        name = '%s_compressed%u' % (self.args.name, i)
+        self.imports.append('IMPORT_FSTR_COMPRESSED(%s, %s)' % (name, self.path(filename)))
+        return '&' + name
+
+    def generate(self):
+        name = self.args.name
+        files = scan(self.args.input)
+        if not files:
+            raise ValueError('No files found')
+
+        pairs = []
+        info = []
+        for i, (key, filename) in enumerate(files):
+            key_name = '%s_key%u' % (name, i)
+            self.definitions.append('DEFINE_FSTR_LOCAL(%s, %s);' % (key_name, fsindex.c_string(key)))
+            content_name, compressed = self.content(i, key, filename)
+            pairs.append('{&%s, &%s}' % (key_name, content_name))
+            info.append('{&%s, %s}' % (self.mime_type(key), compressed))
+
+        includes = ['SortedMap.hpp', 'Array.hpp', 'FileInfo.hpp']
+        declarations = [
+            'DECLARE_FSTR_MAP_SORTED(%s, FSTR::String, FSTR::String)' % name,
+            'DECLARE_FSTR_ARRAY(%sInfo, FSTR::FileInfo)' % name,
+        ]
+        source = self.imports + [''] + self.definitions + [''] + self.mime_definitions + [
+            '',
+            'DEFINE_FSTR_MAP_SORTED(%s, FSTR::String, FSTR::String,\n\t%s);' % (name, ',\n\t'.join(pairs)),
+            '',
+            'DEFINE_FSTR_ARRAY(%sInfo, FSTR::FileInfo,\n\t%s);' % (name, ',\n\t'.join(info)),
+        ]
+        if self.args.index:
+            includes.append('HashIndex.hpp')
+            declarations.append('DECLARE_FSTR_HASH_INDEX(%sIndex)' % name)
+            values = fsindex.HashIndex([key for key, _ in files], True).generate()
+            source += ['', fsindex.emit_definition('DEFINE_FSTR_HASH_INDEX', name + 'Index', values, False)]
+
+        comment = '// Generated using `tools/fsfiles.py %s`, do not edit\n\n' % ' '.join(sys.argv[1:])
+        header = comment + '#pragma once\n\n'
+        header += ''.join('#include <FlashString/%s>\n' % inc for inc in includes)
+        header += '\n' + '\n'.join(declarations) + '\n'
+        source = comment + '#include "%s"\n\n' % os.path.basename(self.args.header) + '\n'.join(source)
+        return header, source.rstrip('\n') + '\n'
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Generate a file map from a directory tree')
+    parser.add_argument('--name', required=True, help='Name of Map object to define')
+    parser.add_argument('-o', '--output', required=True, help='Output source file')
+    parser.add_argument('--header', help='Output header file (default: as source file, with .h extension)')
+    parser.add_argument('--data-dir', help='Where to write hash and compressed files (default: NAME beside output)')
+    parser.add_argument('--prefix', help='Macro giving location of current directory, e.g. PROJECT_DIR')
+    parser.add_argument('--hash', action='store_true', help='Calculate content hashes')
+    parser.add_argument('--compress', action='store_true', help='Store compressed form of files where worthwhile')
+    parser.add_argument('--window-bits', type=int, default=11, choices=range(9, 16), metavar='[9-15]',
+                        help='Size of decompression window as a power of 2 (default: 11, 2048 bytes)')
+    parser.add_argument('--index', action='store_true', help='Generate perfect hash table for lookups')
+    parser.add_argument('--default-mime', default='application/octet-stream',
+                        help='MIME type for unrecognised files (default: application/octet-stream)')
+    parser.add_argument('input', help='Directory containing files')
+    args = parser.parse_args()
+    if args.header is None:
+        args.header = os.path.splitext(args.output)[0] + '.h'
+    if args.data_dir is None:
+        args.data_dir = os.path.join(os.path.dirname(args.output), args.name)
+
+    header, source = Generator(args).generate()
+    with open(args.header, 'w') as f:
+        f.write(header)
+    with open(args.output, 'w') as f:
+        f.write(source)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,71 @@
+#!/usr/bin/env python3
+#
+# fshash.py - Calculate content hashes for use with IMPORT_FSTR_HASHED
+#
+# Copyright 2019 mikee47 <mike@sillyhouse.net>
+#
+# This file is part of the FlashString Library
+#
+# This library is free software: you can redistribute it and/or modify it under the terms of the
+# GNU General Public License as published by the Free Software Foundation, version 3 or later.
+#
+# This library is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+# without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+# See the GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License along with FlashString.
+# If not, see <https://www.gnu.org/licenses/>.
+#
+# Output is a ContentHash structure as described in ContentHash.hpp, written to a file of the same
+# name as the input with '.hash' appended. It must be regenerated whenever the input changes.
+# The content length is recorded so that a hash file whose length no longer matches is ignored.
+#
+# Example:
+#
+#   fshash.py files/index.html files/logo.png
+#   fshash.py --crc32 files/index.html.fsz
+#
+
+import argparse
+import hashlib
+import struct
+import zlib
+
+CRC32_PRESENT = 0x01
+SHA256_PRESENT = 0x02
+HASH_FORMAT = '<I32sII'
+
+
+def create_hash(data, crc32, sha256):
+    flags = 0
+    crc = 0
+    digest = bytes(32)
+    if crc32:
+        crc = zlib.crc32(data) & 0xffffffff
+        flags |= CRC32_PRESENT
+    if sha256:
+        digest = hashlib.sha256(data).digest()
+        flags |= SHA256_PRESENT
+    return struct.pack(HASH_FORMAT, crc, digest, len(data), flags)
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Calculate content hashes for use with IMPORT_FSTR_HASHED')
+    parser.add_argument('--crc32', action='store_true', help='Calculate CRC32')
+    parser.add_argument('--sha256', action='store_true', help='Calculate SHA-256')
+    parser.add_argument('input', nargs='+', help='Files to hash')
+    args = parser.parse_args()
+
+    # Default is both
+    if not args.crc32 and not args.sha256:
+        args.crc32 = args.sha256 = True
+
+    for filename in args.input:
+        with open(filename, 'rb') as f:
+            data = f.read()
+        with open(filename + '.hash', 'wb') as f:
+            f.write(create_hash(data, args.crc32, args.sha256))
+
+
+if __name__ == '__main__':
+    main()
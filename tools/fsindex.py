@@ -0,0 +1,345 @@
+#!/usr/bin/env python3
+#
+# fsindex.py - Generate lookup indices for FlashString objects
+#
+# Copyright 2019 mikee47 <mike@sillyhouse.net>
+#
+# This file is part of the FlashString Library
+#
+# This library is free software: you can redistribute it and/or modify it under the terms of the
+# GNU General Public License as published by the Free Software Foundation, version 3 or later.
+#
+# This library is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+# without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+# See the GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License along with FlashString.
+# If not, see <https://www.gnu.org/licenses/>.
+#
+# Keys are read from a text file, one per line, in the same order as the object being indexed.
+# Output is a C++ definition which can be #included or pasted into a source file.
+#
+# Example:
+#
+#   fsindex.py hash --name fileMapIndex keys.txt > fileMapIndex.h
+#   fsindex.py trie --name routeTrie routes.txt > routeTrie.h
+#   fsindex.py length --name keywordIndex keywords.txt > keywordIndex.h
+#   fsindex.py template --name pageIndex page.html > pageIndex.h
+#
+# For the `template` command, input is the template content itself.
+#
+
+import argparse
+import re
+import sys
+
+FNV_OFFSET = 2166136261
+FNV_PRIME = 16777619
+MASK32 = 0xffffffff
+
+
+def fold_case(c):
+    """Fold an ASCII character (as an integer) to lower case."""
+    return c + 32 if 0x41 <= c <= 0x5a else c
+
+
+def mix(h):
+    """Murmur3 finalizer, must match FSTR::Hash::mix()."""
+    h ^= h >> 16
+    h = (h * 0x85ebca6b) & MASK32
+    h ^= h >> 13
+    h = (h * 0xc2b2ae35) & MASK32
+    h ^= h >> 16
+    return h
+
+
+def calculate_hash(data, ignore_case=False, seed=0):
+    """Hash a bytes object, must match FSTR::Hash::calculate()."""
+    h = FNV_OFFSET ^ seed
+    for c in data:
+        if ignore_case:
+            c = fold_case(c)
+        h = ((h ^ c) * FNV_PRIME) & MASK32
+    return mix(h)
+
+
+def format_values(values, indent='\t', per_line=16):
+    """Format a list of integers as comma-separated lines."""
+    lines = []
+    for i in range(0, len(values), per_line):
+        lines.append(indent + ', '.join(str(v) for v in values[i:i + per_line]))
+    return ',\n'.join(lines)
+
+
+def emit_definition(macro, name, values, local):
+    if local:
+        macro += '_LOCAL'
+    return '%s(%s,\n%s);\n' % (macro, name, format_values(values))
+
+
+def c_string(data):
+    """Quote bytes as a C string literal."""
+    s = ''
+    for c in data:
+        if c in b'"\\':
+            s += '\\' + chr(c)
+        elif 0x20 <= c < 0x7f:
+            s += chr(c)
+        else:
+            # Use octal so following characters can't be taken as part of the escape
+            s += '\\%03o' % c
+    return '"' + s + '"'
+
+
+def read_keys(filename):
+    with open(filename, 'rb') as f:
+        return [line.rstrip(b'\r\n') for line in f]
+
+
+class HashIndex:
+    """Minimal perfect hash using 'hash and displace'.
+
+    Each key hashes to a bucket. Buckets are placed largest first, searching for a
+    displacement value which puts all keys into free slots.
+    """
+    FLAG_IGNORE_CASE = 0x0001
+    DISPLACEMENT_MULTIPLIER = 0x9e3779b1
+
+    def __init__(self, keys, ignore_case):
+        self.keys = keys
+        self.ignore_case = ignore_case
+
+    def slot(self, h, d, count):
+        return mix(h ^ ((d * self.DISPLACEMENT_MULTIPLIER) & MASK32)) % count
+
+    def try_seed(self, seed, bucket_count):
+        count = len(self.keys)
+        buckets = [[] for _ in range(bucket_count)]
+        for i, key in enumerate(self.keys):
+            h = calculate_hash(key, self.ignore_case, seed)
+            buckets[h % bucket_count].append((i, h))
+        displacements = [0] * bucket_count
+        slots = [None] * count
+        for b in sorted(range(bucket_count), key=lambda b: -len(buckets[b])):
+            entries = buckets[b]
+            if not entries:
+                break
+            for d in range(0x10000):
+                candidate = [self.slot(h, d, count) for _, h in entries]
+                if len(set(candidate)) == len(candidate) and all(slots[s] is None for s in candidate):
+                    break
+            else:
+                return None
+            displacements[b] = d
+            for (i, _), s in zip(entries, candidate):
+                slots[s] = i
+        return displacements, slots
+
+    def generate(self):
+        folded = [bytes(fold_case(c) for c in k) for k in self.keys] if self.ignore_case else self.keys
+        if len(set(folded)) != len(folded):
+            raise ValueError('Keys are not unique')
+        if len(self.keys) > 0xffff:
+            raise ValueError('Too many keys')
+        bucket_count = max(1, (len(self.keys) + 3) // 4)
+        for seed in range(0x10000):
+            res = self.try_seed(seed, bucket_count)
+            if res is not None:
+                displacements, slots = res
+                flags = self.FLAG_IGNORE_CASE if self.ignore_case else 0
+                return [seed, flags, bucket_count] + displacements + slots
+        raise ValueError('Failed to generate table')
+
+
+class TrieNode:
+    def __init__(self, label=b''):
+        self.label = label
+        self.value = None
+        self.children = {}
+
+
+class Trie:
+    """Compressed (radix) trie, serialised as described in Trie.hpp."""
+    FLAG_IGNORE_CASE = 0x01
+    FLAG_TERMINAL = 0x01
+    HEADER_SIZE = 4
+    MAX_LABEL = 255
+
+    def __init__(self, keys, ignore_case):
+        self.ignore_case = ignore_case
+        if len(keys) > 0xffff:
+            raise ValueError('Too many keys')
+        self.root = TrieNode()
+        for i, key in enumerate(keys):
+            if ignore_case:
+                key = bytes(fold_case(c) for c in key)
+            self.insert(key, i)
+
+    def insert(self, key, value):
+        node = self.root
+        for c in key:
+            node = node.children.setdefault(c, TrieNode(bytes([c])))
+        if node.value is not None:
+            raise ValueError('Duplicate key %r' % key)
+        node.value = value
+
+    def compress(self, node):
+        """Merge chains of single-child, non-terminal nodes into one label."""
+        while node.value is None and len(node.children) == 1 and len(node.label) < self.MAX_LABEL:
+            child = next(iter(node.children.values()))
+            if len(node.label) + len(child.label) > self.MAX_LABEL:
+                break
+            node.label += child.label
+            node.children = child.children
+            node.value = child.value
+        for child in node.children.values():
+            self.compress(child)
+
+    @staticmethod
+    def node_size(node):
+        return 1 + len(node.label) + 1 + (2 if node.value is not None else 0) + 1 + 4 * len(node.children)
+
+    def generate(self):
+        for child in self.root.children.values():
+            self.compress(child)
+        # Assign offsets, depth-first so related nodes are stored together
+        nodes = []
+        offset = self.HEADER_SIZE
+
+        def layout(node):
+            nonlocal offset
+            node.offset = offset
+            offset += self.node_size(node)
+            nodes.append(node)
+            for c in sorted(node.children):
+                layout(node.children[c])
+
+        layout(self.root)
+        if offset > 0xffffff:
+            raise ValueError('Trie too large')
+        data = bytearray([self.FLAG_IGNORE_CASE if self.ignore_case else 0, 0, 0, 0])
+        for node in nodes:
+            data.append(len(node.label))
+            data += node.label
+            if node.value is None:
+                data.append(0)
+            else:
+                data.append(self.FLAG_TERMINAL)
+                data += node.value.to_bytes(2, 'little')
+            if len(node.children) > 0xff:
+                raise ValueError('Too many children for node %r' % node.label)
+            data.append(len(node.children))
+            for c in sorted(node.children):
+                data.append(c)
+                data += node.children[c].offset.to_bytes(3, 'little')
+        return list(data)
+
+
+class LengthIndex:
+    """Indices of keys grouped by length, as described in LengthIndex.hpp.
+
+    Keys longer than max_length share the final bucket.
+    """
+
+    def __init__(self, keys, max_length=None):
+        if len(keys) > 0xffff:
+            raise ValueError('Too many keys')
+        self.keys = keys
+        longest = max((len(k) for k in keys), default=0)
+        self.max_length = longest if max_length is None else min(max_length, longest)
+
+    def generate(self):
+        bucket_count = self.max_length + 1
+        buckets = [[] for _ in range(bucket_count)]
+        for i, key in enumerate(self.keys):
+            buckets[min(len(key), self.max_length)].append(i)
+        start = [0]
+        for b in buckets:
+            start.append(start[-1] + len(b))
+        return [bucket_count] + start + [i for b in buckets for i in b]
+
+
+class TemplateIndex:
+    """Positions of placeholders in template content, as described in TemplateIndex.hpp."""
+
+    MAX_NAME_LENGTH = 32
+
+    def __init__(self, content, double_braces=False):
+        if len(content) > 0xffffffff:
+            raise ValueError('Template too large')
+        self.content = content
+        self.braces = 2 if double_braces else 1
+
+    def generate(self):
+        name = b'([A-Za-z0-9_]{1,%u})' % self.MAX_NAME_LENGTH
+        pattern = re.escape(b'{' * self.braces) + name + re.escape(b'}' * self.braces)
+        values = []
+        for m in re.finditer(pattern, self.content):
+            tag_length = m.end() - m.start()
+            values += [m.start(), tag_length | (self.braces << 16) | (len(m.group(1)) << 24)]
+        return values
+
+
+def cmd_template(args):
+    with open(args.input, 'rb') as f:
+        content = f.read()
+    values = TemplateIndex(content, args.double_braces).generate()
+    return emit_definition('DEFINE_FSTR_TEMPLATE_INDEX', args.name, values, args.local)
+
+
+def cmd_length(args):
+    keys = read_keys(args.input)
+    values = LengthIndex(keys, args.max_length).generate()
+    return emit_definition('DEFINE_FSTR_LENGTH_INDEX', args.name, values, args.local)
+
+
+def cmd_trie(args):
+    keys = read_keys(args.input)
+    values = Trie(keys, args.ignore_case).generate()
+    return emit_definition('DEFINE_FSTR_TRIE', args.name, values, args.local)
+
+
+def cmd_hash(args):
+    keys = read_keys(args.input)
+    values = HashIndex(keys, args.ignore_case).generate()
+    return emit_definition('DEFINE_FSTR_HASH_INDEX', args.name, values, args.local)
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Generate lookup indices for FlashString objects')
+    parser.add_argument('-o', '--output', help='Output file (default: stdout)')
+    subparsers = parser.add_subparsers(dest='command')
+    subparsers.required = True
+
+    def add_command(name, func, help, input_help='Text file containing keys, one per line'):
+        p = subparsers.add_parser(name, help=help)
+        p.add_argument('--name', required=True, help='Name of object to define')
+        p.add_argument('--local', action='store_true', help='Define object with local reference')
+        p.add_argument('input', help=input_help)
+        p.set_defaults(func=func)
+        return p
+
+    p = add_command('hash', cmd_hash, 'Perfect hash table for a Map with String keys')
+    p.add_argument('--ignore-case', action='store_true', help='Case-insensitive lookups')
+
+    p = add_command('trie', cmd_trie, 'Radix trie for prefix matching of String keys')
+    p.add_argument('--ignore-case', action='store_true', help='Case-insensitive lookups')
+
+    p = add_command('length', cmd_length, 'Length index for a Vector of Strings')
+    p.add_argument('--max-length', type=int, help='Longest length with its own bucket (default: longest key)')
+
+    p = add_command('template', cmd_template, 'Placeholder index for use with IndexedTemplateStream',
+                    'File containing template content, as imported using IMPORT_FSTR')
+    p.add_argument('--double-braces', action='store_true', help='Placeholders are {{name}} instead of {name}')
+
+    args = parser.parse_args()
+    output = args.func(args)
+    if args.output:
+        with open(args.output, 'w') as f:
+            f.write(output)
+    else:
+        sys.stdout.write(output)
+
+
+if __name__ == '__main__':
+    main()
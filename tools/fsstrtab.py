@@ -0,0 +1,162 @@
+#!/usr/bin/env python3
+#
+# fsstrtab.py - Generate a StringTable from a list of strings
+#
+# Copyright 2019 mikee47 <mike@sillyhouse.net>
+#
+# This file is part of the FlashString Library
+#
+# This library is free software: you can redistribute it and/or modify it under the terms of the
+# GNU General Public License as published by the Free Software Foundation, version 3 or later.
+#
+# This library is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+# without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+# See the GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License along with FlashString.
+# If not, see <https://www.gnu.org/licenses/>.
+#
+# Strings are read from a text file, one per line. Output is a C++ definition which can be
+# #included or pasted into a source file. Each string is commented with its index.
+#
+# Duplicate strings, and strings which are the tail of another (e.g. "Error" in "ReadError"),
+# can share storage in a merged table. This costs 4 bytes per index entry instead of 2, so is
+# only used if it produces a smaller table, or if content exceeds the 64KB limit for a plain table.
+#
+# Example:
+#
+#   fsstrtab.py --name labels labels.txt > labels.h
+#
+
+import argparse
+import os
+import sys
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+import fsindex
+
+# Offsets in a plain table are 16 bits
+MAX_CONTENT_SIZE = 0xffff
+
+# Entries in a merged table, must match FSTR::StringTable
+ENTRY_OFFSET_BITS = 22
+MAX_MERGED_OFFSET = (1 << ENTRY_OFFSET_BITS) - 1
+MAX_MERGED_LENGTH = (1 << (32 - ENTRY_OFFSET_BITS)) - 1
+
+
+def build(strings):
+    """Return list of offsets for a plain table, None if content is too large."""
+    offset = 2 * (len(strings) + 1)
+    offsets = [offset]
+    for s in strings:
+        offset += len(s)
+        offsets.append(offset)
+    return offsets if offset <= MAX_CONTENT_SIZE else None
+
+
+def merge(strings):
+    """Find storage for a merged table.
+
+    Returns (stored, locations) where stored is the list of distinct strings to store, in order of
+    first use, and locations gives the (stored index, position) of each string.
+    """
+    # A string is the tail of another if, reversed, it is a prefix. Sorting reversed strings
+    # places each one immediately before the longest string it is a prefix of, if any.
+    distinct = sorted(set(strings), key=lambda s: s[::-1])
+    host = {}
+    for i in reversed(range(len(distinct))):
+        s = distinct[i]
+        if i + 1 < len(distinct) and distinct[i + 1].endswith(s):
+            host[s] = host[distinct[i + 1]]
+        else:
+            host[s] = s
+
+    stored = []
+    positions = {}
+    for s in strings:
+        h = host[s]
+        if h not in positions:
+            positions[h] = len(stored)
+            stored.append(h)
+    locations = [(positions[host[s]], len(host[s]) - len(s)) for s in strings]
+    return stored, locations
+
+
+def build_merged(strings):
+    """Return (stored, locations, entries) for a merged table, where entries are (offset, length) values."""
+    stored, locations = merge(strings)
+    offset = 4 * (len(strings) + 1)
+    starts = []
+    for s in stored:
+        starts.append(offset)
+        offset += len(s)
+    if offset > MAX_MERGED_OFFSET:
+        raise ValueError('Table content is %u bytes, maximum is %u: split into smaller tables' %
+                         (offset, MAX_MERGED_OFFSET))
+    entries = []
+    for s, (i, pos) in zip(strings, locations):
+        if len(s) > MAX_MERGED_LENGTH:
+            raise ValueError('String too long for merged table (%u bytes, maximum is %u)' %
+                             (len(s), MAX_MERGED_LENGTH))
+        entries.append((starts[i] + pos, len(s)))
+    return stored, locations, entries
+
+
+def format_strings(strings, comments):
+    # Comma separating content from index goes after the last string
+    last = len(strings) - 1
+    return '\n'.join('\t%s%s // %s' % (fsindex.c_string(s), ',' if i == last else '', c)
+                     for i, (s, c) in enumerate(zip(strings, comments)))
+
+
+def emit_plain(name, strings, offsets, local):
+    macro = 'DEFINE_FSTR_STRING_TABLE_LOCAL' if local else 'DEFINE_FSTR_STRING_TABLE'
+    content = format_strings(strings, [str(i) for i in range(len(strings))])
+    return '%s(%s,\n%s\n%s);\n' % (macro, name, content, fsindex.format_values(offsets))
+
+
+def emit_merged(name, strings, local):
+    stored, locations, entries = build_merged(strings)
+    # Comment each stored string with the indices of all strings located within it
+    users = [[] for _ in stored]
+    for i, (j, _) in enumerate(locations):
+        users[j].append(str(i))
+    macro = 'DEFINE_FSTR_STRING_TABLE_MERGED_LOCAL' if local else 'DEFINE_FSTR_STRING_TABLE_MERGED'
+    content = format_strings(stored, [', '.join(u) for u in users])
+    index = ['\t%u' % len(strings)] + ['\tFSTR_STRING_TABLE_ENTRY(%u, %u)' % e for e in entries]
+    return '%s(%s,\n%s\n%s);\n' % (macro, name, content, ',\n'.join(index))
+
+
+def merged_size(strings):
+    stored, _ = merge(strings)
+    return 4 * (len(strings) + 1) + sum(len(s) for s in stored)
+
+
+def emit_definition(name, strings, local, mode='auto'):
+    """Emit definition for a table. Mode is 'auto' (use smallest layout), 'merge' or 'plain'."""
+    if not strings:
+        raise ValueError('Table must contain at least one string')
+    offsets = build(strings)
+    if mode == 'plain' or (mode == 'auto' and offsets is not None and offsets[-1] <= merged_size(strings)):
+        if offsets is None:
+            raise ValueError('Table content exceeds %u bytes: split into smaller tables' % MAX_CONTENT_SIZE)
+        return emit_plain(name, strings, offsets, local)
+    return emit_merged(name, strings, local)
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Generate a StringTable from a list of strings')
+    parser.add_argument('--name', required=True, help='Name of StringTable object to define')
+    parser.add_argument('--local', action='store_true', help='Define object with local reference')
+    parser.add_argument('--layout', choices=['auto', 'merge', 'plain'], default='auto',
+                        help='Table layout (default: auto, whichever is smaller)')
+    parser.add_argument('input', help='Text file containing strings, one per line')
+    args = parser.parse_args()
+
+    strings = fsindex.read_keys(args.input)
+    comment = '// Generated using `tools/fsstrtab.py %s`, do not edit\n\n' % ' '.join(sys.argv[1:])
+    sys.stdout.write(comment + emit_definition(args.name, strings, args.local, args.layout))
+
+
+if __name__ == '__main__':
+    main()
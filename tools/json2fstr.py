@@ -0,0 +1,249 @@
+#!/usr/bin/env python3
+#
+# json2fstr.py - Translate a JSON document into FlashString objects
+#
+# Copyright 2019 mikee47 <mike@sillyhouse.net>
+#
+# This file is part of the FlashString Library
+#
+# This library is free software: you can redistribute it and/or modify it under the terms of the
+# GNU General Public License as published by the Free Software Foundation, version 3 or later.
+#
+# This library is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+# without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+# See the GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License along with FlashString.
+# If not, see <https://www.gnu.org/licenses/>.
+#
+# Output is a C++ source file and matching header defining NAME, the root of the document.
+# JSON values are translated as follows:
+#
+#   object      Map<String, T>, in document order
+#   array       Array<T> if all values are numbers or all are booleans, otherwise Vector<T>
+#   string      String
+#   number      String containing the JSON text, e.g. "80" (except within an Array)
+#   boolean     String "true" or "false" (except within an Array)
+#   null        nullptr, which reads as an empty (null) object
+#
+# T is the common type of the contained values. Where these differ, T is String and entries
+# must be cast to the appropriate type using `as<>()`. Empty objects and arrays are stored as nullptr.
+# Integers in an Array must fit in 64 bits. NaN, Infinity and out-of-range floats are rejected.
+# Identical strings, including keys, are stored only once, as are identical objects and arrays.
+#
+# The header defines a type alias for each Map type, annotated with the location of its first use.
+#
+# Example, run from the project directory:
+#
+#   json2fstr.py --name config -o app/config.cpp files/config.json
+#
+
+import argparse
+import json
+import math
+import os
+import sys
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+import fsindex
+
+STRING = 'FSTR::String'
+
+INT32_MIN = -0x80000000
+INT32_MAX = 0x7fffffff
+INT64_MIN = -0x8000000000000000
+INT64_MAX = 0x7fffffffffffffff
+
+
+def is_number(value):
+    return isinstance(value, (int, float)) and not isinstance(value, bool)
+
+
+def array_type(values):
+    """Get element type for an array of numbers or booleans, None if values can't be stored in an Array."""
+    if all(isinstance(v, bool) for v in values):
+        return 'bool'
+    if not all(is_number(v) for v in values):
+        return None
+    if any(isinstance(v, float) for v in values):
+        return 'double'
+    if all(INT32_MIN <= v <= INT32_MAX for v in values):
+        return 'int32_t'
+    if all(INT64_MIN <= v <= INT64_MAX for v in values):
+        return 'int64_t'
+    raise ValueError('Integer out of range')
+
+
+def array_element(value, element_type):
+    if element_type == 'bool':
+        return 'true' if value else 'false'
+    if element_type == 'double':
+        return repr(float(value))
+    # The minimum value can't be written as a literal, as the negated constant is out of range
+    if element_type == 'int64_t':
+        return '(%dLL - 1)' % (value + 1) if value == INT64_MIN else '%dLL' % value
+    return '(%d - 1)' % (value + 1) if value == INT32_MIN else '%d' % value
+
+
+def parse_float(text):
+    value = float(text)
+    if math.isinf(value):
+        raise ValueError('Number out of range: %s' % text)
+    return value
+
+
+def parse_constant(name):
+    # Python accepts these, but they aren't valid JSON
+    raise ValueError('Invalid JSON value: %s' % name)
+
+
+def common_type(types):
+    """Get content type for a container, and whether values need casting to it."""
+    types = set(t for t in types if t is not None)
+    if len(types) == 1:
+        return types.pop(), False
+    return STRING, len(types) > 1
+
+
+class Generator:
+    def __init__(self, name):
+        self.name = name
+        self.strings = {}
+        self.string_definitions = []
+        self.aliases = {}
+        self.alias_definitions = []
+        self.definitions = []
+        self.objects = {}
+        self.object_count = 0
+
+    def string(self, value):
+        """Get name of String object for the given bytes, defining it if required."""
+        name = self.strings.get(value)
+        if name is None:
+            name = '%s_str%u' % (self.name, len(self.strings))
+            self.strings[value] = name
+            self.string_definitions.append('DEFINE_FSTR_LOCAL(%s, %s);' % (name, fsindex.c_string(value)))
+        return name
+
+    def alias(self, object_type, path):
+        """Map types contain commas so can't be passed to macros. Use an alias instead."""
+        name = self.aliases.get(object_type)
+        if name is None:
+            name = '%s_Map%u' % (self.name, len(self.aliases))
+            self.aliases[object_type] = name
+            self.alias_definitions.append('// %s\nusing %s = %s;' % (path, name, object_type))
+        return name
+
+    def define(self, macro, object_type, args, is_root):
+        """Define an object, or re-use an identical one. Returns its name."""
+        if is_root:
+            self.definitions.append('%s(%s, %s);' % (macro, self.name, args))
+            return self.name
+        key = (macro, object_type, args)
+        name = self.objects.get(key)
+        if name is None:
+            name = '%s_%u' % (self.name, self.object_count)
+            self.object_count += 1
+            self.objects[key] = name
+            self.definitions.append('%s_LOCAL(%s, %s);' % (macro, name, args))
+        return name
+
+    def value(self, value, path, is_root=False):
+        """Define an object for a JSON value.
+
+        Returns (type, name) for the object. For null values, and empty containers, this is (None, None).
+        """
+        if value is None:
+            return None, None
+        if isinstance(value, dict):
+            return self.map(value, path, is_root)
+        if isinstance(value, list):
+            return self.list(value, path, is_root)
+        if isinstance(value, str):
+            data = value.encode()
+        else:
+            data = json.dumps(value).encode()
+        if is_root:
+            self.definitions.append('DEFINE_FSTR(%s, %s);' % (self.name, fsindex.c_string(data)))
+            return STRING, self.name
+        return STRING, self.string(data)
+
+    def content(self, items):
+        """Define objects for (value, path) items in a container, returning content type and list of pointers."""
+        objects = [self.value(v, path) for v, path in items]
+        content_type, cast = common_type(t for t, _ in objects)
+        refs = []
+        for object_type, name in objects:
+            if name is None:
+                refs.append('nullptr')
+            elif cast and object_type != content_type:
+                # As for DEFINE_FSTR_REF, taking the address of the packed member directly would be unaligned
+                refs.append('&FSTR_DATA_NAME(%s).object.as<%s>()' % (name, content_type))
+            else:
+                refs.append('&' + name)
+        return content_type, refs
+
+    def map(self, value, path, is_root):
+        if not value:
+            return None, None
+        keys = [self.string(k.encode()) for k in value]
+        content_type, refs = self.content((v, '%s.%s' % (path, k)) for k, v in value.items())
+        pairs = ['{&%s, %s}' % (k, r) for k, r in zip(keys, refs)]
+        object_type = 'FSTR::Map<%s, %s>' % (STRING, content_type)
+        args = '%s, %s,\n\t%s' % (STRING, content_type, ',\n\t'.join(pairs))
+        name = self.define('DEFINE_FSTR_MAP', object_type, args, is_root)
+        return self.alias(object_type, path), name
+
+    def list(self, value, path, is_root):
+        if not value:
+            return None, None
+        element_type = array_type(value)
+        if element_type is not None:
+            elements = [array_element(v, element_type) for v in value]
+            object_type = 'FSTR::Array<%s>' % element_type
+            args = '%s, %s' % (element_type, ', '.join(elements))
+            return object_type, self.define('DEFINE_FSTR_ARRAY', object_type, args, is_root)
+        content_type, refs = self.content((v, '%s[%u]' % (path, i)) for i, v in enumerate(value))
+        object_type = 'FSTR::Vector<%s>' % content_type
+        args = '%s,\n\t%s' % (content_type, ',\n\t'.join(refs))
+        return object_type, self.define('DEFINE_FSTR_VECTOR', object_type, args, is_root)
+
+    def generate(self, document, header_name):
+        root_type, _ = self.value(document, '$', True)
+        if root_type is None:
+            raise ValueError('Document root must not be null or empty')
+
+        comment = '// Generated using `tools/json2fstr.py %s`, do not edit\n\n' % ' '.join(sys.argv[1:])
+        header = comment + '#pragma once\n\n'
+        header += ''.join('#include <FlashString/%s>\n' % inc for inc in ['Map.hpp', 'Vector.hpp', 'Array.hpp'])
+        header += '\n' + ''.join(a + '\n' for a in self.alias_definitions)
+        header += '\nextern const %s& %s;\n' % (root_type, self.name)
+
+        source = [comment + '#include "%s"' % header_name, '']
+        if self.string_definitions:
+            source += self.string_definitions + ['']
+        source += self.definitions
+        return header, '\n'.join(source) + '\n'
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Translate a JSON document into FlashString objects')
+    parser.add_argument('--name', required=True, help='Name of root object to define')
+    parser.add_argument('-o', '--output', required=True, help='Output source file')
+    parser.add_argument('--header', help='Output header file (default: as source file, with .h extension)')
+    parser.add_argument('input', help='JSON document')
+    args = parser.parse_args()
+    if args.header is None:
+        args.header = os.path.splitext(args.output)[0] + '.h'
+
+    with open(args.input, 'rb') as f:
+        document = json.loads(f.read().decode('utf-8'), parse_float=parse_float, parse_constant=parse_constant)
+    header, source = Generator(args.name).generate(document, os.path.basename(args.header))
+    with open(args.header, 'w') as f:
+        f.write(header)
+    with open(args.output, 'w') as f:
+        f.write(source)
+
+
+if __name__ == '__main__':
+    main()